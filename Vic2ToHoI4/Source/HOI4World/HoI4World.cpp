@@ -8,11 +8,9 @@
 #include "Events/GovernmentInExileEvent.h"
 #include "HOI4World/Characters/CharacterFactory.h"
 #include "HOI4World/Characters/CharactersFactory.h"
-#include "HOI4World/Map/HoI4ProvinceDefinitionImporter.h"
 #include "HOI4World/Map/ImpassableProvinces.h"
 #include "HOI4World/Map/Railways.h"
 #include "HOI4World/Map/SupplyNodes.h"
-#include "HOI4World/States/DefaultStatesImporter.h"
 #include "HoI4Country.h"
 #include "HoI4FocusTree.h"
 #include "HoI4Localisation.h"
@@ -91,7 +89,8 @@ void checkAllProvincesAssignedToRegion(const HoI4::Regions& theRegions,
 
 HoI4::World::World(const Vic2::World& sourceWorld,
 	 const Mappers::ProvinceMapper& provinceMapper,
-	 const Configuration& theConfiguration):
+	 const Configuration& theConfiguration,
+	 SaveIndependentData saveIndependentData):
 	 theIdeas(std::make_unique<HoI4::Ideas>()),
 	 theDecisions(make_unique<HoI4::decisions>(theConfiguration)), peaces(make_unique<HoI4::AiPeaces>()),
 	 events(make_unique<HoI4::Events>()), onActions(make_unique<HoI4::OnActions>())
@@ -102,20 +101,19 @@ HoI4::World::World(const Vic2::World& sourceWorld,
 	Mappers::CountryMapper::Factory countryMapperFactory;
 	countryMap = countryMapperFactory.importCountryMapper(sourceWorld, theConfiguration.getDebug());
 
-	auto vic2Localisations = sourceWorld.getLocalisations();
-	hoi4Localisations = Localisation::Importer().generateLocalisations(theConfiguration.getHoI4Path());
+	const auto& vic2Localisations = sourceWorld.getLocalisations();
+	hoi4Localisations = std::move(saveIndependentData.localisations);
 	Log(LogLevel::Progress) << "28%";
 
 	theDate = std::make_unique<date>(sourceWorld.getDate());
 
 	Character::Factory characterFactory;
-	provinceDefinitions =
-		 std::make_unique<Maps::ProvinceDefinitions>(importProvinceDefinitions(theConfiguration.getHoI4Path()));
-	theMapData = std::make_unique<Maps::MapData>(*provinceDefinitions, theConfiguration.getHoI4Path());
+	provinceDefinitions = std::move(saveIndependentData.provinceDefinitions);
+	theMapData = std::move(saveIndependentData.mapData);
 	const auto theProvinces = importProvinces(theConfiguration);
 	theCoastalProvinces.init(*theMapData, theProvinces);
-	strategicRegions = StrategicRegions::Factory().importStrategicRegions(theConfiguration);
-	const auto defaultStates = DefaultStatesImporter().ImportDefaultStates(theConfiguration.getHoI4Path());
+	strategicRegions = std::move(saveIndependentData.strategicRegions);
+	const auto defaultStates = std::move(saveIndependentData.defaultStates);
 	const ImpassableProvinces impassableProvinces(defaultStates);
 	states = std::make_unique<States>(sourceWorld,
 		 *countryMap,
@@ -47,6 +47,7 @@
 #include "Operations/Operations.h"
 #include "OperativeNames/OperativeNames.h"
 #include "Parser.h"
+#include "SaveIndependentData.h"
 #include "ScriptedEffects/ScriptedEffects.h"
 #include "ScriptedLocalisations/ScriptedLocalisations.h"
 #include "ScriptedTriggers/ScriptedTriggers.h"
@@ -73,7 +74,8 @@ class World: commonItems::parser
   public:
 	explicit World(const Vic2::World& sourceWorld,
 		 const Mappers::ProvinceMapper& provinceMapper,
-		 const Configuration& theConfiguration);
+		 const Configuration& theConfiguration,
+		 SaveIndependentData saveIndependentData);
 	~World() = default;
 
 	[[nodiscard]] const auto& getHumanCountry() const { return humanCountry; }
@@ -23,82 +23,77 @@ HoI4::Buildings::Buildings(const States& theStates,
 
 void HoI4::Buildings::importDefaultBuildings(Maps::MapData& theMapData, const Configuration& theConfiguration)
 {
-	std::ifstream buildingsFile(theConfiguration.getHoI4Path() + "/map/buildings.txt");
-	if (!buildingsFile.is_open())
+	Maps::CsvReader buildingsFile(theConfiguration.getHoI4Path() + "/map/buildings.txt");
+	while (buildingsFile.readRecord())
 	{
-		throw std::runtime_error("Could not open " + theConfiguration.getHoI4Path() + "/map/buildings.txt");
-	}
-
-	while (!buildingsFile.eof())
-	{
-		std::string line;
-		getline(buildingsFile, line);
-		processLine(line, theMapData);
+		processRecord(buildingsFile, theMapData);
 	}
 }
 
 
-void HoI4::Buildings::processLine(const std::string& line, Maps::MapData& theMapData)
+// records are state;type;x;y;z;rotation;connecting sea province
+void HoI4::Buildings::processRecord(const Maps::CsvReader& buildingsFile, Maps::MapData& theMapData)
 {
-	const std::regex pattern("(.+);(.+);(.+);(.+);(.+);(.+);(.+)");
-	std::smatch matches;
-	if (regex_match(line, matches, pattern))
+	if (buildingsFile.getNumFields() < 7)
 	{
-		if (matches[2] == "arms_factory")
-		{
-			importDefaultBuilding(matches, defaultArmsFactories, theMapData);
-		}
-		else if (matches[2] == "industrial_complex")
-		{
-			importDefaultBuilding(matches, defaultIndustrialComplexes, theMapData);
-		}
-		else if (matches[2] == "air_base")
-		{
-			importDefaultBuilding(matches, defaultAirBases, theMapData);
-		}
-		else if (matches[2] == "naval_base")
-		{
-			importDefaultBuilding(matches, defaultNavalBases, theMapData);
-		}
-		else if (matches[2] == "bunker")
-		{
-			importDefaultBuilding(matches, defaultBunkers, theMapData);
-		}
-		else if (matches[2] == "coastal_bunker")
-		{
-			importDefaultBuilding(matches, defaultCoastalBunkers, theMapData);
-		}
-		else if (matches[2] == "dockyard")
-		{
-			importDefaultBuilding(matches, defaultDockyards, theMapData);
-		}
-		else if (matches[2] == "anti_air_building")
-		{
-			importDefaultBuilding(matches, defaultAntiAirs, theMapData);
-		}
-		else if (matches[2] == "synthetic_refinery")
-		{
-			importDefaultBuilding(matches, defaultSyntheticRefineries, theMapData);
-		}
-		else if (matches[2] == "nuclear_reactor")
-		{
-			importDefaultBuilding(matches, defaultNuclearReactors, theMapData);
-		}
+		return;
+	}
+
+	const auto buildingType = buildingsFile.getField(1);
+	if (buildingType == "arms_factory")
+	{
+		importDefaultBuilding(buildingsFile, defaultArmsFactories, theMapData);
+	}
+	else if (buildingType == "industrial_complex")
+	{
+		importDefaultBuilding(buildingsFile, defaultIndustrialComplexes, theMapData);
+	}
+	else if (buildingType == "air_base")
+	{
+		importDefaultBuilding(buildingsFile, defaultAirBases, theMapData);
+	}
+	else if (buildingType == "naval_base")
+	{
+		importDefaultBuilding(buildingsFile, defaultNavalBases, theMapData);
+	}
+	else if (buildingType == "bunker")
+	{
+		importDefaultBuilding(buildingsFile, defaultBunkers, theMapData);
+	}
+	else if (buildingType == "coastal_bunker")
+	{
+		importDefaultBuilding(buildingsFile, defaultCoastalBunkers, theMapData);
+	}
+	else if (buildingType == "dockyard")
+	{
+		importDefaultBuilding(buildingsFile, defaultDockyards, theMapData);
+	}
+	else if (buildingType == "anti_air_building")
+	{
+		importDefaultBuilding(buildingsFile, defaultAntiAirs, theMapData);
+	}
+	else if (buildingType == "synthetic_refinery")
+	{
+		importDefaultBuilding(buildingsFile, defaultSyntheticRefineries, theMapData);
+	}
+	else if (buildingType == "nuclear_reactor")
+	{
+		importDefaultBuilding(buildingsFile, defaultNuclearReactors, theMapData);
 	}
 }
 
 
-void HoI4::Buildings::importDefaultBuilding(const std::smatch& matches,
+void HoI4::Buildings::importDefaultBuilding(const Maps::CsvReader& buildingsFile,
 	 defaultPositions& positions,
 	 Maps::MapData& theMapData) const
 {
 	BuildingPosition position;
-	position.xCoordinate = stof(matches[3].str());
-	position.yCoordinate = stof(matches[4].str());
-	position.zCoordinate = stof(matches[5].str());
-	position.rotation = stof(matches[6].str());
+	position.xCoordinate = buildingsFile.getFloat(2);
+	position.yCoordinate = buildingsFile.getFloat(3);
+	position.zCoordinate = buildingsFile.getFloat(4);
+	position.rotation = buildingsFile.getFloat(5);
 
-	auto connectingSeaProvince = stoi(matches[7].str());
+	auto connectingSeaProvince = buildingsFile.getInt(6);
 
 	if (auto province = theMapData.getProvinceNumber(
 			  {static_cast<int>(position.xCoordinate), static_cast<int>(position.zCoordinate)});
@@ -155,14 +150,13 @@ void HoI4::Buildings::placeArmsFactories(const States& theStates, const Maps::Ma
 		{
 			for (auto theProvince: state.second.getProvinces())
 			{
-				auto theProvincePoints = theMapData.getProvincePoints(theProvince);
-				if (theProvincePoints)
+				const auto centermostPoint = theMapData.getCentermostPoint(theProvince);
+				if (centermostPoint)
 				{
-					const auto centermostPoint = theProvincePoints->getCentermostPoint();
 					BuildingPosition thePosition;
-					thePosition.xCoordinate = centermostPoint.first;
+					thePosition.xCoordinate = centermostPoint->first;
 					thePosition.yCoordinate = 11.0;
-					thePosition.zCoordinate = centermostPoint.second;
+					thePosition.zCoordinate = centermostPoint->second;
 					thePosition.rotation = 0;
 					buildings.insert(std::make_pair(state.first, Building(state.first, "arms_factory", thePosition, 0)));
 					numPlaced++;
@@ -210,14 +204,13 @@ void HoI4::Buildings::placeIndustrialComplexes(const States& theStates, const Ma
 		{
 			for (auto theProvince: state.second.getProvinces())
 			{
-				auto theProvincePoints = theMapData.getProvincePoints(theProvince);
-				if (theProvincePoints)
+				const auto centermostPoint = theMapData.getCentermostPoint(theProvince);
+				if (centermostPoint)
 				{
-					const auto centermostPoint = theProvincePoints->getCentermostPoint();
 					BuildingPosition thePosition;
-					thePosition.xCoordinate = centermostPoint.first;
+					thePosition.xCoordinate = centermostPoint->first;
 					thePosition.yCoordinate = 11.0;
-					thePosition.zCoordinate = centermostPoint.second;
+					thePosition.zCoordinate = centermostPoint->second;
 					thePosition.rotation = 0;
 					buildings.insert(
 						 std::make_pair(state.first, Building(state.first, "industrial_complex", thePosition, 0)));
@@ -264,14 +257,13 @@ void HoI4::Buildings::placeAirports(const States& theStates, const Maps::MapData
 			auto theProvince = *state.second.getProvinces().begin();
 			airportLocations.insert(std::make_pair(state.first, theProvince));
 
-			auto theProvincePoints = theMapData.getProvincePoints(theProvince);
-			if (theProvincePoints)
+			const auto centermostPoint = theMapData.getCentermostPoint(theProvince);
+			if (centermostPoint)
 			{
-				const auto centermostPoint = theProvincePoints->getCentermostPoint();
 				BuildingPosition thePosition;
-				thePosition.xCoordinate = centermostPoint.first;
+				thePosition.xCoordinate = centermostPoint->first;
 				thePosition.yCoordinate = 11.0;
-				thePosition.zCoordinate = centermostPoint.second;
+				thePosition.zCoordinate = centermostPoint->second;
 				thePosition.rotation = 0;
 				buildings.insert(std::make_pair(state.first, Building(state.first, "air_base", thePosition, 0)));
 			}
@@ -311,14 +303,13 @@ void HoI4::Buildings::placeAntiAir(const States& theStates, const Maps::MapData&
 		{
 			for (auto theProvince: state.second.getProvinces())
 			{
-				auto theProvincePoints = theMapData.getProvincePoints(theProvince);
-				if (theProvincePoints)
+				const auto centermostPoint = theMapData.getCentermostPoint(theProvince);
+				if (centermostPoint)
 				{
-					const auto centermostPoint = theProvincePoints->getCentermostPoint();
 					BuildingPosition thePosition;
-					thePosition.xCoordinate = centermostPoint.first;
+					thePosition.xCoordinate = centermostPoint->first;
 					thePosition.yCoordinate = 11.0;
-					thePosition.zCoordinate = centermostPoint.second;
+					thePosition.zCoordinate = centermostPoint->second;
 					thePosition.rotation = 0;
 					buildings.insert(
 						 std::make_pair(state.first, Building(state.first, "anti_air_building", thePosition, 0)));
@@ -610,14 +601,13 @@ void HoI4::Buildings::placeSyntheticRefineries(const States& theStates, const Ma
 		if (!refineryPlaced)
 		{
 			const auto theProvince = *state.second.getProvinces().begin();
-			auto theProvincePoints = theMapData.getProvincePoints(theProvince);
-			if (theProvincePoints)
+			const auto centermostPoint = theMapData.getCentermostPoint(theProvince);
+			if (centermostPoint)
 			{
-				const auto centermostPoint = theProvincePoints->getCentermostPoint();
 				BuildingPosition thePosition;
-				thePosition.xCoordinate = centermostPoint.first;
+				thePosition.xCoordinate = centermostPoint->first;
 				thePosition.yCoordinate = 11.0;
-				thePosition.zCoordinate = centermostPoint.second;
+				thePosition.zCoordinate = centermostPoint->second;
 				thePosition.rotation = 0;
 				buildings.insert(std::make_pair(state.first, Building(state.first, "synthetic_refinery", thePosition, 0)));
 			}
@@ -652,14 +642,13 @@ void HoI4::Buildings::placeNuclearReactors(const States& theStates, const Maps::
 		if (!reactorPlaced)
 		{
 			const auto theProvince = *state.second.getProvinces().begin();
-			auto theProvincePoints = theMapData.getProvincePoints(theProvince);
-			if (theProvincePoints)
+			const auto centermostPoint = theMapData.getCentermostPoint(theProvince);
+			if (centermostPoint)
 			{
-				const auto centermostPoint = theProvincePoints->getCentermostPoint();
 				BuildingPosition thePosition;
-				thePosition.xCoordinate = centermostPoint.first;
+				thePosition.xCoordinate = centermostPoint->first;
 				thePosition.yCoordinate = 11.0;
-				thePosition.zCoordinate = centermostPoint.second;
+				thePosition.zCoordinate = centermostPoint->second;
 				thePosition.rotation = 0;
 				buildings.insert(std::make_pair(state.first, Building(state.first, "nuclear_reactor", thePosition, 0)));
 			}
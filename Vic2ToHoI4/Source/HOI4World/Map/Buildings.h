@@ -8,11 +8,11 @@
 #include "HOI4World/Map/CoastalProvinces.h"
 #include "HOI4World/States/HoI4States.h"
 #include "Hoi4Building.h"
+#include "Maps/CsvReader.h"
 #include "Maps/MapData.h"
 #include "Maps/ProvinceDefinitions.h"
 #include <map>
 #include <optional>
-#include <regex>
 #include <string>
 #include <vector>
 
@@ -37,8 +37,10 @@ class Buildings
 
   private:
 	void importDefaultBuildings(Maps::MapData& theMapData, const Configuration& theConfiguration);
-	void processLine(const std::string& line, Maps::MapData& theMapData);
-	void importDefaultBuilding(const std::smatch& matches, defaultPositions& positions, Maps::MapData& theMapData) const;
+	void processRecord(const Maps::CsvReader& buildingsFile, Maps::MapData& theMapData);
+	void importDefaultBuilding(const Maps::CsvReader& buildingsFile,
+		 defaultPositions& positions,
+		 Maps::MapData& theMapData) const;
 
 	void placeBuildings(const States& theStates,
 		 const CoastalProvinces& theCoastalProvinces,
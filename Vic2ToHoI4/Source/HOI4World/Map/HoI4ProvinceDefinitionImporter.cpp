@@ -1,78 +1,45 @@
 #include "HoI4ProvinceDefinitionImporter.h"
-#include <fstream>
+#include "Maps/CsvReader.h"
 
 
 
+// records are number;red;green;blue;land or sea;coastal;terrain;continent, and reading stops at the first short one
 Maps::ProvinceDefinitions HoI4::importProvinceDefinitions(const std::string& path)
 {
-	std::ifstream definitions(path + "/map/definition.csv");
-	if (!definitions.is_open())
-	{
-		throw std::runtime_error("Could not open " + path + "/map/definition.csv");
-	}
+	Maps::CsvReader definitions(path + "/map/definition.csv");
 
 	std::set<int> landProvinces;
 	std::set<int> seaProvinces;
 	std::map<int, std::string> terrain_types;
 	std::map<int, int> colorToProvinceMap;
 
-	while (true)
+	while (definitions.readRecord())
 	{
-		std::string line;
-		getline(definitions, line);
-
-		// number
-		auto pos = line.find_first_of(';');
-		if (pos == std::string::npos)
+		if (definitions.getNumFields() < 2)
 		{
 			break;
 		}
-		auto provNum = stoi(line.substr(0, pos));
+		const auto provNum = definitions.getInt(0);
 		if (provNum == 0)
 		{
 			continue;
 		}
-		line = line.substr(pos + 1, line.length());
-
-		// red
-		pos = line.find_first_of(';');
-		if (pos == std::string::npos)
-		{
-			break;
-		}
-		const int red(stoi(line.substr(0, pos)));
-		line = line.substr(pos + 1, line.length());
-
-		// green
-		pos = line.find_first_of(';');
-		if (pos == std::string::npos)
-		{
-			break;
-		}
-		const int green(stoi(line.substr(0, pos)));
-		line = line.substr(pos + 1, line.length());
 
-		// blue
-		pos = line.find_first_of(';');
-		if (pos == std::string::npos)
+		if (definitions.getNumFields() < 5)
 		{
 			break;
 		}
-		const int blue(stoi(line.substr(0, pos)));
-		line = line.substr(pos + 1, line.length());
-
+		const int red = definitions.getInt(1);
+		const int green = definitions.getInt(2);
+		const int blue = definitions.getInt(3);
 		auto colorInt = Maps::getIntFromColor(commonItems::Color(std::array{red, green, blue}));
 		colorToProvinceMap.insert(std::make_pair(colorInt, provNum));
 
-		// land or sea
-		pos = line.find_first_of(';');
-		if (pos == std::string::npos)
+		if (definitions.getNumFields() < 6)
 		{
 			break;
 		}
-		const std::string landOrSea = line.substr(0, pos);
-		line = line.substr(pos + 1, line.length());
-		if (landOrSea == "land")
+		if (const auto landOrSea = definitions.getField(4); landOrSea == "land")
 		{
 			landProvinces.insert(provNum);
 		}
@@ -81,24 +48,12 @@ Maps::ProvinceDefinitions HoI4::importProvinceDefinitions(const std::string& pat
 			seaProvinces.insert(provNum);
 		}
 
-		// false or true
-		pos = line.find_first_of(';');
-		if (pos == std::string::npos)
-		{
-			break;
-		}
-		line = line.substr(pos + 1, line.length());
-
-		// terrain
-		pos = line.find_first_of(';');
-		if (pos == std::string::npos)
+		if (definitions.getNumFields() < 8)
 		{
 			break;
 		}
-		const std::string terrain = line.substr(0, pos);
-		line = line.substr(pos + 1, line.length());
-		terrain_types.emplace(provNum, terrain);
+		terrain_types.emplace(provNum, std::string(definitions.getField(6)));
 	}
 
 	return Maps::ProvinceDefinitions(landProvinces, seaProvinces, terrain_types, colorToProvinceMap);
-}
\ No newline at end of file
+}
@@ -1,8 +1,12 @@
 #include "Railways.h"
-#include "HOI4World/Map/PossiblePath.h"
 #include "Log.h"
+#include <algorithm>
+#include <cstdint>
+#include <future>
 #include <numeric>
 #include <queue>
+#include <thread>
+#include <unordered_set>
 
 
 
@@ -48,104 +52,185 @@ std::set<int> findValidVic2ProvinceNumbers(const std::vector<std::reference_wrap
 }
 
 
+// The Vic2 province graph flattened into arrays indexed by province number, so the searches from each valid province
+// can share it without map lookups or per-search allocations.
+class Vic2ProvinceGraph
+{
+  public:
+	Vic2ProvinceGraph(const std::set<int>& validVic2ProvinceNumbers,
+		 const std::map<int, std::shared_ptr<Vic2::Province>>& Vic2Provinces);
+
+	[[nodiscard]] bool isLand(const int province) const { return isInRange(province) && isLand_[province]; }
+	[[nodiscard]] bool isValid(const int province) const { return isInRange(province) && isValid_[province]; }
+	[[nodiscard]] int getPopulation(const int province) const { return populations_[province]; }
+
+	// Starts a new search; provinces visited by earlier searches are forgotten without clearing anything
+	void startSearch() { ++searchNumber_; }
+	bool visit(int province);
+
+	void setPrevious(const int province, const int previous) { previousProvinces_[province] = previous; }
+	[[nodiscard]] int getPrevious(const int province) const { return previousProvinces_[province]; }
+	[[nodiscard]] std::vector<int> getPathTo(int province) const;
+
+  private:
+	[[nodiscard]] bool isInRange(const int province) const
+	{
+		return province >= 0 && province < static_cast<int>(isLand_.size());
+	}
+
+	std::vector<bool> isLand_;
+	std::vector<bool> isValid_;
+	std::vector<int> populations_;
+
+	int searchNumber_ = 0;
+	std::vector<int> visitedSearchNumbers_;
+	std::vector<int> previousProvinces_;
+};
+
+
+Vic2ProvinceGraph::Vic2ProvinceGraph(const std::set<int>& validVic2ProvinceNumbers,
+	 const std::map<int, std::shared_ptr<Vic2::Province>>& Vic2Provinces)
+{
+	if (Vic2Provinces.empty() || Vic2Provinces.rbegin()->first < 0)
+	{
+		return;
+	}
+
+	const auto numProvinces = static_cast<size_t>(Vic2Provinces.rbegin()->first) + 1;
+	isLand_.resize(numProvinces, false);
+	isValid_.resize(numProvinces, false);
+	populations_.resize(numProvinces, 0);
+	visitedSearchNumbers_.resize(numProvinces, 0);
+	previousProvinces_.resize(numProvinces, 0);
+
+	for (const auto& [provinceNumber, province]: Vic2Provinces)
+	{
+		if (provinceNumber < 0)
+		{
+			continue;
+		}
+		isLand_[provinceNumber] = province->isLandProvince();
+		populations_[provinceNumber] = province->getPopulation();
+	}
+	for (const auto& provinceNumber: validVic2ProvinceNumbers)
+	{
+		if (isInRange(provinceNumber))
+		{
+			isValid_[provinceNumber] = true;
+		}
+	}
+}
+
+
+bool Vic2ProvinceGraph::visit(const int province)
+{
+	if (!isInRange(province) || visitedSearchNumbers_[province] == searchNumber_)
+	{
+		return false;
+	}
+
+	visitedSearchNumbers_[province] = searchNumber_;
+	return true;
+}
+
+
+std::vector<int> Vic2ProvinceGraph::getPathTo(int province) const
+{
+	std::vector<int> path{province};
+	while (previousProvinces_[province] != province)
+	{
+		province = previousProvinces_[province];
+		path.push_back(province);
+	}
+	std::ranges::reverse(path);
+	return path;
+}
+
+
+// From each valid province, search outward through land provinces until other valid provinces are found, and keep a
+// path to the most populous of them (or every one that is adjacent). The search always continues from the
+// lexicographically greatest path, which is the largest province among those most recently found, so a stack in
+// neighbor order reproduces it without building any paths.
 std::set<std::vector<int>> determineVic2ProvincePaths(const std::set<int>& validVic2ProvinceNumbers,
 	 const std::map<int, std::shared_ptr<Vic2::Province>>& Vic2Provinces,
 	 const Maps::MapData& Vic2MapData)
 {
+	Vic2ProvinceGraph provinceGraph(validVic2ProvinceNumbers, Vic2Provinces);
+
 	std::set<std::vector<int>> vic2ProvincePaths;
+	std::vector<int> provincesToSearchFrom;
+	std::vector<int> foundValidProvinces;
 	for (const auto& vic2ProvinceNum: validVic2ProvinceNumbers)
 	{
-		const auto provinceItr = Vic2Provinces.find(vic2ProvinceNum);
-		if (provinceItr == Vic2Provinces.end())
+		if (!provinceGraph.isLand(vic2ProvinceNum))
 		{
 			continue;
 		}
-		const auto& vic2Province = provinceItr->second;
-
-		if (!vic2Province->isLandProvince())
-		{
-			continue;
-		}
-		std::set handledProvinces{vic2ProvinceNum};
-
-		std::set<std::vector<int>> potentialNewVic2ProvincePaths;
 
-		std::priority_queue<std::vector<int>> newPaths;
-		newPaths.push({vic2ProvinceNum});
+		provinceGraph.startSearch();
+		provinceGraph.visit(vic2ProvinceNum);
+		provinceGraph.setPrevious(vic2ProvinceNum, vic2ProvinceNum);
 
-		while (!newPaths.empty())
+		foundValidProvinces.clear();
+		provincesToSearchFrom.assign({vic2ProvinceNum});
+		while (!provincesToSearchFrom.empty())
 		{
-			auto path = newPaths.top();
-			newPaths.pop();
+			const auto currentProvince = provincesToSearchFrom.back();
+			provincesToSearchFrom.pop_back();
 
-			const auto lastProvince = path[path.size() - 1];
-			for (const auto& neighborNumber: Vic2MapData.getNeighbors(lastProvince))
+			for (const auto& neighborNumber: Vic2MapData.getNeighbors(currentProvince))
 			{
-				if (handledProvinces.contains(neighborNumber))
+				if (!provinceGraph.visit(neighborNumber) || !provinceGraph.isLand(neighborNumber))
 				{
 					continue;
 				}
-				handledProvinces.insert(neighborNumber);
 
-				const auto neighborItr = Vic2Provinces.find(neighborNumber);
-				if (neighborItr == Vic2Provinces.end())
+				provinceGraph.setPrevious(neighborNumber, currentProvince);
+				if (provinceGraph.isValid(neighborNumber))
 				{
-					continue;
-				}
-				const auto& neighborProvince = neighborItr->second;
-				if (!neighborProvince->isLandProvince())
-				{
-					continue;
-				}
-
-				auto newPath = path;
-				newPath.push_back(neighborNumber);
-				if (validVic2ProvinceNumbers.contains(neighborNumber))
-				{
-					potentialNewVic2ProvincePaths.insert(newPath);
+					foundValidProvinces.push_back(neighborNumber);
 				}
 				else
 				{
-					newPaths.push(newPath);
+					provincesToSearchFrom.push_back(neighborNumber);
 				}
 			}
 		}
 
-		std::vector<int> bestPotentialNewPath;
+		std::optional<std::vector<int>> bestPotentialNewPath;
 		long potentialNewPathScore = 0;
-		for (const auto& potentialNewVic2ProvincePath: potentialNewVic2ProvincePaths)
+		for (const auto& foundProvince: foundValidProvinces)
 		{
-			if (potentialNewVic2ProvincePath.size() == 2)
+			if (provinceGraph.getPrevious(foundProvince) == vic2ProvinceNum)
 			{
-				auto reversedPath = potentialNewVic2ProvincePath;
-				std::ranges::reverse(reversedPath);
-				if (!vic2ProvincePaths.contains(reversedPath))
+				if (!vic2ProvincePaths.contains({foundProvince, vic2ProvinceNum}))
 				{
-					vic2ProvincePaths.insert(potentialNewVic2ProvincePath);
+					vic2ProvincePaths.insert({vic2ProvinceNum, foundProvince});
 				}
 				continue;
 			}
 
-			const int potentialLastProvinceNum = potentialNewVic2ProvincePath[potentialNewVic2ProvincePath.size() - 1];
-			const auto potentialLastProvinceItr = Vic2Provinces.find(potentialLastProvinceNum);
-			if (potentialLastProvinceItr == Vic2Provinces.end())
+			const int potentialLastProvincePopulation = provinceGraph.getPopulation(foundProvince);
+			if (potentialLastProvincePopulation < potentialNewPathScore || potentialLastProvincePopulation == 0)
 			{
 				continue;
 			}
-			const int potentialLastProvincePopulation = potentialLastProvinceItr->second->getPopulation();
-			if (potentialLastProvincePopulation > potentialNewPathScore)
+
+			// equally populous destinations go to the lexicographically smallest path
+			auto potentialNewPath = provinceGraph.getPathTo(foundProvince);
+			if (potentialLastProvincePopulation > potentialNewPathScore || potentialNewPath < *bestPotentialNewPath)
 			{
-				bestPotentialNewPath = potentialNewVic2ProvincePath;
+				bestPotentialNewPath = std::move(potentialNewPath);
 				potentialNewPathScore = potentialLastProvincePopulation;
 			}
 		}
-		if (!bestPotentialNewPath.empty())
+		if (bestPotentialNewPath)
 		{
-			auto reversedPath = bestPotentialNewPath;
+			auto reversedPath = *bestPotentialNewPath;
 			std::ranges::reverse(reversedPath);
 			if (!vic2ProvincePaths.contains(reversedPath))
 			{
-				vic2ProvincePaths.insert(bestPotentialNewPath);
+				vic2ProvincePaths.insert(*bestPotentialNewPath);
 			}
 		}
 	}
@@ -296,6 +381,30 @@ bool HoI4ProvinceNumbersAreValid(std::optional<int> firstNumber, std::optional<i
 }
 
 
+// railways may only pass through HoI4 provinces that map to the Vic2 provinces the railway is between
+std::vector<int> findAllowedHoI4Provinces(const std::vector<int>& vic2ProvincePath,
+	 const Mappers::ProvinceMapper& provinceMapper)
+{
+	const std::unordered_set<int> vic2Provinces(vic2ProvincePath.begin(), vic2ProvincePath.end());
+
+	std::vector<int> allowedProvinces;
+	for (const auto vic2Province: vic2ProvincePath)
+	{
+		for (const auto HoI4Province: provinceMapper.getVic2ToHoI4ProvinceMapping(vic2Province))
+		{
+			if (std::ranges::any_of(provinceMapper.getHoI4ToVic2ProvinceMapping(HoI4Province),
+					  [&vic2Provinces](const int mappedProvince) {
+						  return vic2Provinces.contains(mappedProvince);
+					  }))
+			{
+				allowedProvinces.push_back(HoI4Province);
+			}
+		}
+	}
+	return allowedProvinces;
+}
+
+
 constexpr int urban_cost = 1;
 constexpr int plains_cost = 2;
 constexpr int forest_cost = 3;
@@ -305,7 +414,7 @@ constexpr int marsh_cost = 5;
 constexpr int jungle_cost = 8;
 constexpr int mountain_cost = 8;
 constexpr int unhandled_cost = 100;
-int getCostForTerrainType(const std::string& terrainType)
+std::optional<int> getCostForTerrainType(const std::string& terrainType)
 {
 	if (terrainType == "urban")
 	{
@@ -340,99 +449,267 @@ int getCostForTerrainType(const std::string& terrainType)
 		return mountain_cost;
 	}
 
-	Log(LogLevel::Warning) << "Unhandled terrain type " << terrainType << ". Please inform the converter team.";
-	return unhandled_cost;
+	return std::nullopt;
 }
 
 
 double getDistanceBetweenProvinces(int provinceOne, int provinceTwo, const Maps::MapData& HoI4MapData)
 {
-	const auto possibleProvinceOnePoints = HoI4MapData.getProvincePoints(provinceOne);
-	if (!possibleProvinceOnePoints)
+	const auto provinceOneCentermostPoint = HoI4MapData.getCentermostPoint(provinceOne);
+	if (!provinceOneCentermostPoint)
 	{
 		return std::numeric_limits<double>::max();
 	}
-	const auto provinceOneCentermostPoint = possibleProvinceOnePoints->getCentermostPoint();
 
-	const auto possibleProvinceTwoPoints = HoI4MapData.getProvincePoints(provinceTwo);
-	if (!possibleProvinceTwoPoints)
+	const auto provinceTwoCentermostPoint = HoI4MapData.getCentermostPoint(provinceTwo);
+	if (!provinceTwoCentermostPoint)
 	{
 		return std::numeric_limits<double>::max();
 	}
-	const auto provinceTwoCentermostPoint = possibleProvinceTwoPoints->getCentermostPoint();
 
-	const int deltaX = provinceOneCentermostPoint.first - provinceTwoCentermostPoint.first;
-	const int deltaY = provinceOneCentermostPoint.second - provinceTwoCentermostPoint.second;
+	const int deltaX = provinceOneCentermostPoint->first - provinceTwoCentermostPoint->first;
+	const int deltaY = provinceOneCentermostPoint->second - provinceTwoCentermostPoint->second;
 	return std::sqrt(deltaX * deltaX + deltaY * deltaY);
 }
 
 
-std::optional<std::vector<int>> findPath(int startProvince,
-	 int endProvince,
-	 const std::vector<int>& vic2Provinces,
-	 const Mappers::ProvinceMapper& provinceMapper,
-	 const Maps::MapData& HoI4MapData,
-	 const Maps::ProvinceDefinitions& HoI4ProvinceDefinitions,
-	 const HoI4::ImpassableProvinces& impassableProvinces)
+// Cheapest-first search for railway routes through HoI4 provinces. The search state lives in arrays indexed by province
+// number that are reused between searches; each entry is stamped with the search that wrote it, so nothing needs
+// clearing. A route is kept as the previous province of each province reached, rather than as a copy per route.
+class RailwayRouter
 {
-	std::priority_queue<HoI4::PossiblePath> possibleRailwayPaths;
-	std::set reachedProvinces{startProvince};
+  public:
+	RailwayRouter(const Maps::MapData& HoI4MapData,
+		 const Maps::ProvinceDefinitions& HoI4ProvinceDefinitions,
+		 const HoI4::ImpassableProvinces& impassableProvinces):
+		 HoI4MapData_(HoI4MapData),
+		 HoI4ProvinceDefinitions_(HoI4ProvinceDefinitions), impassableProvinces_(impassableProvinces)
+	{
+	}
 
-	const HoI4::PossiblePath startingPath(startProvince);
-	possibleRailwayPaths.push(startingPath);
+	[[nodiscard]] std::optional<std::vector<int>> findPath(int startProvince,
+		 int endProvince,
+		 const std::vector<int>& allowedProvinces,
+		 std::vector<std::string>& warnings);
 
-	while (!possibleRailwayPaths.empty() && possibleRailwayPaths.top().getLastProvince() != endProvince)
+  private:
+	struct FrontierEntry
 	{
-		auto possibleRailwayPath = possibleRailwayPaths.top();
-		possibleRailwayPaths.pop();
+		double pathCost = 0.0;
+		int province = 0;
+
+		// priority_queue pops the largest entry, so lower costs must compare larger. Equal costs are left to the queue,
+		// which then orders them just as it did whole routes, so railways keep their routes.
+		[[nodiscard]] bool operator<(const FrontierEntry& rhs) const { return pathCost > rhs.pathCost; }
+	};
+
+	void makeRoomFor(int province);
+	[[nodiscard]] bool isReached(int province) const { return searchNumbers_[province] == searchNumber_; }
+	[[nodiscard]] bool isAllowed(int province) const { return allowedSearchNumbers_[province] == searchNumber_; }
+	[[nodiscard]] bool canHoldRailway(int province);
+	[[nodiscard]] double getCost(int province, std::vector<std::string>& warnings);
 
-		const auto lastProvince = possibleRailwayPath.getLastProvince();
-		for (const auto& neighborNumber: HoI4MapData.getNeighbors(lastProvince))
+	const Maps::MapData& HoI4MapData_;
+	const Maps::ProvinceDefinitions& HoI4ProvinceDefinitions_;
+	const HoI4::ImpassableProvinces& impassableProvinces_;
+
+	int searchNumber_ = 0;
+	std::vector<int> searchNumbers_;
+	std::vector<int> previousProvinces_;
+	std::vector<int> allowedSearchNumbers_;
+
+	// facts about provinces that don't change between searches, filled in as provinces are first seen
+	std::vector<int8_t> canHoldRailway_; // -1 is not yet known
+	std::vector<double> terrainCosts_;	 // negative is not yet known
+	std::vector<bool> unhandledTerrain_;
+};
+
+
+void RailwayRouter::makeRoomFor(const int province)
+{
+	if (province < static_cast<int>(searchNumbers_.size()))
+	{
+		return;
+	}
+
+	const auto newSize = static_cast<size_t>(province) + 1;
+	searchNumbers_.resize(newSize, 0);
+	previousProvinces_.resize(newSize, 0);
+	allowedSearchNumbers_.resize(newSize, 0);
+	canHoldRailway_.resize(newSize, -1);
+	terrainCosts_.resize(newSize, -1.0);
+	unhandledTerrain_.resize(newSize, false);
+}
+
+
+bool RailwayRouter::canHoldRailway(const int province)
+{
+	if (canHoldRailway_[province] == -1)
+	{
+		canHoldRailway_[province] = HoI4ProvinceDefinitions_.isLandProvince(province) &&
+											 !impassableProvinces_.isProvinceImpassable(province);
+	}
+	return canHoldRailway_[province] == 1;
+}
+
+
+// Unhandled terrain is reported by every search that meets it, not just the first one on this router, so which
+// searches report it doesn't depend on how they were split between routers.
+double RailwayRouter::getCost(const int province, std::vector<std::string>& warnings)
+{
+	if (terrainCosts_[province] < 0.0)
+	{
+		const auto cost = getCostForTerrainType(HoI4ProvinceDefinitions_.getTerrainType(province));
+		terrainCosts_[province] = cost.value_or(unhandled_cost);
+		unhandledTerrain_[province] = !cost;
+	}
+	if (unhandledTerrain_[province])
+	{
+		const auto warning = "Unhandled terrain type " + HoI4ProvinceDefinitions_.getTerrainType(province) +
+									". Please inform the converter team.";
+		if (std::ranges::find(warnings, warning) == warnings.end())
 		{
-			if (reachedProvinces.contains(neighborNumber))
+			warnings.push_back(warning);
+		}
+	}
+	return terrainCosts_[province];
+}
+
+
+std::optional<std::vector<int>> RailwayRouter::findPath(const int startProvince,
+	 const int endProvince,
+	 const std::vector<int>& allowedProvinces,
+	 std::vector<std::string>& warnings)
+{
+	if (startProvince < 0 || endProvince < 0)
+	{
+		return std::nullopt;
+	}
+	makeRoomFor(std::max(startProvince, endProvince));
+	searchNumber_++;
+	for (const auto province: allowedProvinces)
+	{
+		makeRoomFor(province);
+		allowedSearchNumbers_[province] = searchNumber_;
+	}
+
+	// A province is reached when it's first queued, and later routes to it are ignored even if they're cheaper. That
+	// isn't always the cheapest route, but it's the one railways have always taken.
+	std::priority_queue<FrontierEntry> frontier;
+	searchNumbers_[startProvince] = searchNumber_;
+	previousProvinces_[startProvince] = startProvince;
+	frontier.push({0.0, startProvince});
+
+	while (!frontier.empty())
+	{
+		const auto [pathCost, currentProvince] = frontier.top();
+		frontier.pop();
+
+		if (currentProvince == endProvince)
+		{
+			std::vector<int> path{endProvince};
+			for (auto province = endProvince; province != startProvince;)
 			{
-				continue;
+				province = previousProvinces_[province];
+				path.push_back(province);
 			}
-			reachedProvinces.insert(neighborNumber);
-			if (!HoI4ProvinceDefinitions.isLandProvince(neighborNumber))
+			std::ranges::reverse(path);
+			return path;
+		}
+
+		for (const auto& neighborNumber: HoI4MapData_.getNeighbors(currentProvince))
+		{
+			if (neighborNumber < 0)
 			{
 				continue;
 			}
-			if (impassableProvinces.isProvinceImpassable(neighborNumber))
+			makeRoomFor(neighborNumber);
+			if (isReached(neighborNumber))
 			{
 				continue;
 			}
-			const auto& vic2NeighborNumbers = provinceMapper.getHoI4ToVic2ProvinceMapping(neighborNumber);
-			bool neighborIsValid = false;
-			for (const auto& vic2NeighborNumber: vic2NeighborNumbers)
+			searchNumbers_[neighborNumber] = searchNumber_;
+			if (!canHoldRailway(neighborNumber))
 			{
-				for (const auto& vic2Province: vic2Provinces)
-				{
-					if (vic2NeighborNumber == vic2Province)
-					{
-						neighborIsValid = true;
-						break;
-					}
-				}
+				continue;
 			}
-			if (!neighborIsValid)
+			if (!isAllowed(neighborNumber))
 			{
 				continue;
 			}
 
-			auto newPossibleRailwayPath = possibleRailwayPath;
-			newPossibleRailwayPath.addProvince(neighborNumber,
-				 getCostForTerrainType(HoI4ProvinceDefinitions.getTerrainType(neighborNumber)) *
-					  getDistanceBetweenProvinces(neighborNumber, lastProvince, HoI4MapData));
-			possibleRailwayPaths.push(newPossibleRailwayPath);
+			const auto stepCost = getCost(neighborNumber, warnings) *
+										 getDistanceBetweenProvinces(neighborNumber, currentProvince, HoI4MapData_);
+			previousProvinces_[neighborNumber] = currentProvince;
+			frontier.push({pathCost + stepCost, neighborNumber});
 		}
 	}
 
-	if (possibleRailwayPaths.empty())
+	return std::nullopt;
+}
+
+
+struct RailwayRequest
+{
+	std::vector<int> allowedHoI4Provinces;
+	int level = 0;
+	int startProvince = 0;
+	int endProvince = 0;
+};
+
+
+// Searches are independent of each other, so they are spread across workers that each have their own router. Workers
+// take every n-th request so long and short searches even out, and results are kept in request order. Warnings are
+// kept with their request too, and logged in request order once all searches are done.
+std::vector<std::optional<std::vector<int>>> findRailwayPaths(const std::vector<RailwayRequest>& railwayRequests,
+	 const Maps::MapData& HoI4MapData,
+	 const Maps::ProvinceDefinitions& HoI4ProvinceDefinitions,
+	 const HoI4::ImpassableProvinces& impassableProvinces)
+{
+	std::vector<std::optional<std::vector<int>>> railwayPaths(railwayRequests.size());
+	std::vector<std::vector<std::string>> railwayWarnings(railwayRequests.size());
+	if (railwayRequests.empty())
 	{
-		return std::nullopt;
+		return railwayPaths;
 	}
-	return possibleRailwayPaths.top().getProvinces();
+
+	const auto numWorkers = std::clamp(static_cast<size_t>(std::thread::hardware_concurrency()),
+		 static_cast<size_t>(1),
+		 railwayRequests.size());
+
+	std::vector<std::future<void>> workers;
+	for (size_t firstRequest = 0; firstRequest < numWorkers; ++firstRequest)
+	{
+		workers.push_back(std::async(std::launch::async, [&, firstRequest] {
+			RailwayRouter router(HoI4MapData, HoI4ProvinceDefinitions, impassableProvinces);
+			for (auto i = firstRequest; i < railwayRequests.size(); i += numWorkers)
+			{
+				const auto& railwayRequest = railwayRequests[i];
+				railwayPaths[i] = router.findPath(railwayRequest.startProvince,
+					 railwayRequest.endProvince,
+					 railwayRequest.allowedHoI4Provinces,
+					 railwayWarnings[i]);
+			}
+		}));
+	}
+	for (auto& worker: workers)
+	{
+		worker.get();
+	}
+
+	std::unordered_set<std::string> loggedWarnings;
+	for (const auto& warnings: railwayWarnings)
+	{
+		for (const auto& warning: warnings)
+		{
+			if (loggedWarnings.insert(warning).second)
+			{
+				Log(LogLevel::Warning) << warning;
+			}
+		}
+	}
+
+	return railwayPaths;
 }
 
 } // namespace
@@ -454,6 +731,7 @@ HoI4::Railways::Railways(const std::map<int, std::shared_ptr<Vic2::Province>>& V
 	const auto validVic2ProvinceNumbers = findValidVic2ProvinceNumbers(states, Vic2Provinces);
 	const auto vic2provincePaths = determineVic2ProvincePaths(validVic2ProvinceNumbers, Vic2Provinces, Vic2MapData);
 
+	std::vector<RailwayRequest> railwayRequests;
 	for (const auto& vic2provincePath: vic2provincePaths)
 	{
 		const int railwayLevel = getRailwayLevel(vic2provincePath, Vic2Provinces);
@@ -477,19 +755,23 @@ HoI4::Railways::Railways(const std::map<int, std::shared_ptr<Vic2::Province>>& V
 			continue;
 		}
 
-		if (const auto possiblePath = findPath(*HoI4StartProvinceNumber,
-				  *HoI4EndProvinceNumber,
-				  vic2provincePath,
-				  provinceMapper,
-				  HoI4MapData,
-				  HoI4ProvinceDefinitions,
-				  impassableProvinces);
-			 possiblePath)
+		railwayRequests.push_back({findAllowedHoI4Provinces(vic2provincePath, provinceMapper),
+			 railwayLevel,
+			 *HoI4StartProvinceNumber,
+			 *HoI4EndProvinceNumber});
+	}
+
+	const auto railwayPaths =
+		 findRailwayPaths(railwayRequests, HoI4MapData, HoI4ProvinceDefinitions, impassableProvinces);
+	for (size_t i = 0; i < railwayRequests.size(); ++i)
+	{
+		const auto& railwayRequest = railwayRequests[i];
+		if (const auto& possiblePath = railwayPaths[i]; possiblePath)
 		{
-			Railway railway(railwayLevel, *possiblePath);
+			Railway railway(railwayRequest.level, *possiblePath);
 			railways_.push_back(railway);
-			railway_endpoints_.insert(*HoI4StartProvinceNumber);
-			railway_endpoints_.insert(*HoI4EndProvinceNumber);
+			railway_endpoints_.insert(railwayRequest.startProvince);
+			railway_endpoints_.insert(railwayRequest.endProvince);
 		}
 	}
 }
\ No newline at end of file
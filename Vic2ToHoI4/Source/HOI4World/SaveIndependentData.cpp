@@ -0,0 +1,31 @@
+#include "SaveIndependentData.h"
+#include "HOI4World/Map/HoI4ProvinceDefinitionImporter.h"
+#include "HOI4World/States/DefaultStatesImporter.h"
+#include <future>
+
+
+
+HoI4::SaveIndependentData HoI4::importSaveIndependentData(const Configuration& theConfiguration)
+{
+	const auto& hoi4Path = theConfiguration.getHoI4Path();
+
+	auto localisations = std::async(std::launch::async, [&hoi4Path] {
+		return Localisation::Importer().generateLocalisations(hoi4Path);
+	});
+	auto strategicRegions = std::async(std::launch::async, [&theConfiguration] {
+		return StrategicRegions::Factory().importStrategicRegions(theConfiguration);
+	});
+	auto defaultStates = std::async(std::launch::async, [&hoi4Path] {
+		return DefaultStatesImporter().ImportDefaultStates(hoi4Path);
+	});
+
+	SaveIndependentData saveIndependentData;
+	saveIndependentData.provinceDefinitions =
+		 std::make_unique<Maps::ProvinceDefinitions>(importProvinceDefinitions(hoi4Path));
+	saveIndependentData.mapData = std::make_unique<Maps::MapData>(*saveIndependentData.provinceDefinitions, hoi4Path);
+	saveIndependentData.localisations = localisations.get();
+	saveIndependentData.strategicRegions = strategicRegions.get();
+	saveIndependentData.defaultStates = defaultStates.get();
+
+	return saveIndependentData;
+}
@@ -0,0 +1,37 @@
+#ifndef HOI4_SAVE_INDEPENDENT_DATA_H
+#define HOI4_SAVE_INDEPENDENT_DATA_H
+
+
+
+#include "Configuration.h"
+#include "HoI4Localisation.h"
+#include "Map/StrategicRegions.h"
+#include "Maps/MapData.h"
+#include "Maps/ProvinceDefinitions.h"
+#include "States/DefaultState.h"
+#include <map>
+#include <memory>
+
+
+
+namespace HoI4
+{
+
+// The parts of the HoI4 world that only depend on the HoI4 install, so they can be loaded while the save is parsed
+struct SaveIndependentData
+{
+	std::unique_ptr<Maps::ProvinceDefinitions> provinceDefinitions;
+	std::unique_ptr<Maps::MapData> mapData;
+	std::map<int, DefaultState> defaultStates;
+	std::unique_ptr<StrategicRegions> strategicRegions;
+	std::unique_ptr<Localisation> localisations;
+};
+
+
+[[nodiscard]] SaveIndependentData importSaveIndependentData(const Configuration& theConfiguration);
+
+} // namespace HoI4
+
+
+
+#endif // HOI4_SAVE_INDEPENDENT_DATA_H
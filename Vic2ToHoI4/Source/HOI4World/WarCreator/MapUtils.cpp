@@ -1,9 +1,10 @@
 #include "MapUtils.h"
 #include "HOI4World/States/HoI4State.h"
 #include "Log.h"
+#include "Maps/CsvReader.h"
+#include "OSCompatibilityLayer.h"
 #include <limits>
 #include <ranges>
-#include <sstream>
 
 
 
@@ -24,58 +25,46 @@ HoI4::MapUtils::MapUtils(const std::map<int, State>& theStates,
 
 void HoI4::MapUtils::establishProvincePositions()
 {
-	std::ifstream positionsFile("Configurables/positions.txt");
-
-	std::string line;
-	while (getline(positionsFile, line))
+	// a missing positions file has always just meant no known positions
+	if (!commonItems::DoesFileExist("Configurables/positions.txt"))
 	{
-		processPositionLine(line);
+		return;
 	}
 
-	positionsFile.close();
-}
-
-
-void HoI4::MapUtils::processPositionLine(const std::string& line)
-{
-	const auto lineTokens = tokenizeLine(line);
-	if (lineTokens.size() < 5)
+	Maps::CsvReader positionsFile("Configurables/positions.txt");
+	while (positionsFile.readRecord())
 	{
-		Log(LogLevel::Warning) << "positions.txt line had too few sections: " << line;
-		return;
+		processPositionRecord(positionsFile);
 	}
-
-	addProvincePosition(lineTokens);
 }
 
 
-std::vector<std::string> HoI4::MapUtils::tokenizeLine(const std::string& line) const
+void HoI4::MapUtils::processPositionRecord(const Maps::CsvReader& positionsFile)
 {
-	std::vector<std::string> parts;
-	std::stringstream ss(line);
-	std::string tok;
-	while (getline(ss, tok, ';'))
+	if (positionsFile.getNumFields() < 5)
 	{
-		parts.push_back(tok);
+		Log(LogLevel::Warning) << "positions.txt line had too few sections: " << positionsFile.getLine();
+		return;
 	}
 
-	return parts;
+	addProvincePosition(positionsFile);
 }
 
 
-void HoI4::MapUtils::addProvincePosition(const std::vector<std::string>& lineTokens)
+// positions are stored with decimals, but only their whole parts are kept
+void HoI4::MapUtils::addProvincePosition(const Maps::CsvReader& positionsFile)
 {
 	try
 	{
-		auto province = std::stoi(lineTokens[0]);
-		auto x = std::stoi(lineTokens[2]);
-		auto y = std::stoi(lineTokens[4]);
+		const auto province = positionsFile.getInt(0);
+		const auto x = static_cast<int>(positionsFile.getFloat(2));
+		const auto y = static_cast<int>(positionsFile.getFloat(4));
 
 		provincePositions.insert(std::make_pair(province, Coordinate{.x = x, .y = y}));
 	}
-	catch (...)
+	catch (const std::runtime_error& error)
 	{
-		Log(LogLevel::Warning) << "Bad line when getting province positions";
+		Log(LogLevel::Warning) << "Bad line when getting province positions: " << error.what();
 	}
 }
 
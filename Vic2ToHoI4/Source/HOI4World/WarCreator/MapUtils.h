@@ -5,6 +5,7 @@
 
 #include "HOI4World/HoI4Country.h"
 #include "HOI4World/HoI4World.h"
+#include "Maps/CsvReader.h"
 #include <memory>
 #include <optional>
 
@@ -49,9 +50,8 @@ class MapUtils
 
   private:
 	void establishProvincePositions();
-	void addProvincePosition(const std::vector<std::string>& lineTokens);
-	[[nodiscard]] std::vector<std::string> tokenizeLine(const std::string& line) const;
-	void processPositionLine(const std::string& line);
+	void processPositionRecord(const Maps::CsvReader& positionsFile);
+	void addProvincePosition(const Maps::CsvReader& positionsFile);
 	void determineProvinceOwners(const std::map<int, State>& theStates);
 	void establishDistancesBetweenCountries(const std::map<std::string, std::shared_ptr<Country>>& theCountries);
 
@@ -0,0 +1,94 @@
+#ifndef LOADED_RESOURCES_H
+#define LOADED_RESOURCES_H
+
+
+
+#include "ModLoader/ModLoader.h"
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+
+
+// Resources read from static game files, keyed by where they were read from. Each one is loaded the first time it's
+// asked for, and later requests for the same key share that copy. A resource is loaded outside the lock, so different
+// resources load at once, while requests for one that's still loading wait for it. A resource that fails to load (a
+// null result or an exception) isn't kept, so each caller that needs it tries again.
+template <typename Resource> class LoadedResources
+{
+  public:
+	template <typename Loader> std::shared_ptr<const Resource> get(const std::string& key, Loader&& load)
+	{
+		while (true)
+		{
+			std::promise<std::shared_ptr<const Resource>> loading;
+			std::shared_future<std::shared_ptr<const Resource>> resource;
+			bool loadHere = false;
+			{
+				std::scoped_lock lock(mutex_);
+				auto [entry, inserted] = resources_.try_emplace(key);
+				if (inserted)
+				{
+					entry->second = loading.get_future().share();
+				}
+				resource = entry->second;
+				loadHere = inserted;
+			}
+
+			if (!loadHere)
+			{
+				if (auto loaded = resource.get(); loaded)
+				{
+					return loaded;
+				}
+				continue;
+			}
+
+			std::shared_ptr<const Resource> loaded;
+			try
+			{
+				loaded = load();
+			}
+			catch (...)
+			{
+				forget(key);
+				loading.set_value(nullptr);
+				throw;
+			}
+			if (!loaded)
+			{
+				forget(key);
+			}
+			loading.set_value(loaded);
+			return loaded;
+		}
+	}
+
+  private:
+	void forget(const std::string& key)
+	{
+		std::scoped_lock lock(mutex_);
+		resources_.erase(key);
+	}
+
+	std::mutex mutex_;
+	std::map<std::string, std::shared_future<std::shared_ptr<const Resource>>> resources_;
+};
+
+
+// The key for a resource read from a game install and the mods that can override it
+[[nodiscard]] inline std::string makeResourceKey(const std::string& path, const Mods& mods)
+{
+	auto key = path;
+	for (const auto& mod: mods)
+	{
+		key += '\n' + mod.path;
+	}
+	return key;
+}
+
+
+
+#endif // LOADED_RESOURCES_H
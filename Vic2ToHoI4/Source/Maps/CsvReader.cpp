@@ -0,0 +1,136 @@
+#include "CsvReader.h"
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
+
+
+
+namespace
+{
+
+constexpr std::string_view utf8ByteOrderMark = "\xEF\xBB\xBF";
+
+
+std::string readWholeFile(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Could not open " + path);
+	}
+
+	std::string contents(static_cast<size_t>(file.tellg()), '\0');
+	file.seekg(0);
+	file.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+	return contents;
+}
+
+} // namespace
+
+
+
+Maps::CsvReader::CsvReader(const std::string& path): CsvReader(readWholeFile(path), path)
+{
+}
+
+
+Maps::CsvReader::CsvReader(std::string contents, std::string sourceName):
+	 contents_(std::move(contents)), sourceName_(std::move(sourceName))
+{
+	if (std::string_view(contents_).starts_with(utf8ByteOrderMark))
+	{
+		position_ = utf8ByteOrderMark.size();
+	}
+}
+
+
+bool Maps::CsvReader::readRecord()
+{
+	if (position_ >= contents_.size())
+	{
+		return false;
+	}
+
+	const std::string_view remainingContents(contents_.data() + position_, contents_.size() - position_);
+	const auto lineEnd = remainingContents.find('\n');
+	line_ = remainingContents.substr(0, lineEnd);
+	position_ = (lineEnd == std::string_view::npos) ? contents_.size() : position_ + lineEnd + 1;
+	if (line_.ends_with('\r'))
+	{
+		line_.remove_suffix(1);
+	}
+	++lineNumber_;
+
+	fields_.clear();
+	for (size_t fieldStart = 0;;)
+	{
+		const auto fieldEnd = line_.find(';', fieldStart);
+		fields_.push_back(line_.substr(fieldStart, fieldEnd - fieldStart));
+		if (fieldEnd == std::string_view::npos)
+		{
+			break;
+		}
+		fieldStart = fieldEnd + 1;
+	}
+
+	return true;
+}
+
+
+std::string_view Maps::CsvReader::getField(const size_t index) const
+{
+	if (index >= fields_.size())
+	{
+		throwError("expected at least " + std::to_string(index + 1) + " fields");
+	}
+	return fields_[index];
+}
+
+
+int Maps::CsvReader::getInt(const size_t index) const
+{
+	const auto field = getNumberField(index);
+
+	int value = 0;
+	if (const auto [end, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+		 error != std::errc() || end != field.data() + field.size())
+	{
+		throwError("'" + std::string(field) + "' is not an integer");
+	}
+	return value;
+}
+
+
+float Maps::CsvReader::getFloat(const size_t index) const
+{
+	const auto field = getNumberField(index);
+
+	float value = 0.0F;
+	if (const auto [end, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+		 error != std::errc() || end != field.data() + field.size())
+	{
+		throwError("'" + std::string(field) + "' is not a number");
+	}
+	return value;
+}
+
+
+// numbers are sometimes padded with spaces, which from_chars won't skip by itself
+std::string_view Maps::CsvReader::getNumberField(const size_t index) const
+{
+	auto field = getField(index);
+	const auto start = field.find_first_not_of(" \t");
+	if (start == std::string_view::npos)
+	{
+		return {};
+	}
+	field.remove_prefix(start);
+	field.remove_suffix(field.size() - field.find_last_not_of(" \t") - 1);
+	return field;
+}
+
+
+void Maps::CsvReader::throwError(const std::string& problem) const
+{
+	throw std::runtime_error(sourceName_ + " line " + std::to_string(lineNumber_) + ": " + problem);
+}
@@ -0,0 +1,56 @@
+#ifndef MAPS_CSV_READER_H
+#define MAPS_CSV_READER_H
+
+
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+
+namespace Maps
+{
+
+// Reads semicolon-separated records from a buffer holding the whole file. Fields are views into that buffer and are
+// replaced when the next record is read.
+class CsvReader
+{
+  public:
+	// throws if the file can't be opened
+	explicit CsvReader(const std::string& path);
+	CsvReader(std::string contents, std::string sourceName);
+
+	CsvReader(const CsvReader&) = delete;
+	CsvReader& operator=(const CsvReader&) = delete;
+
+	// moves to the next line, returning false once there are none left
+	bool readRecord();
+
+	[[nodiscard]] int getLineNumber() const { return lineNumber_; }
+	[[nodiscard]] std::string_view getLine() const { return line_; }
+	[[nodiscard]] size_t getNumFields() const { return fields_.size(); }
+
+	// these throw, naming the file and line, if the field is missing or isn't a number
+	[[nodiscard]] std::string_view getField(size_t index) const;
+	[[nodiscard]] int getInt(size_t index) const;
+	[[nodiscard]] float getFloat(size_t index) const;
+
+  private:
+	[[nodiscard]] std::string_view getNumberField(size_t index) const;
+	[[noreturn]] void throwError(const std::string& problem) const;
+
+	std::string contents_;
+	std::string sourceName_;
+	size_t position_ = 0;
+
+	int lineNumber_ = 0;
+	std::string_view line_;
+	std::vector<std::string_view> fields_;
+};
+
+} // namespace Maps
+
+
+
+#endif // MAPS_CSV_READER_H
@@ -1,83 +1,159 @@
 #include "MapData.h"
 #include "Color.h"
 #include "Configuration.h"
+#include "CsvReader.h"
 #include "Log.h"
+#include <algorithm>
+#include <future>
+#include <thread>
 
 
 
 namespace
 {
 
-commonItems::Color getCenterColor(const Maps::Point position, const bitmap_image& provinceMap)
-{
-	rgb_t color{0, 0, 0};
-	provinceMap.get_pixel(position.first, position.second, color);
-
-	return commonItems::Color(std::array<int, 3>{color.red, color.green, color.blue});
-}
+constexpr int noProvince = 0;
 
 
-commonItems::Color getAboveColor(Maps::Point position, const bitmap_image& provinceMap)
+// everything learned from scanning one horizontal stripe of the province map
+struct ProvinceMapStripe
+{
+	std::map<int, std::set<int>> provinceNeighbors;
+	std::map<int, Maps::bordersWith> borders;
+	std::map<int, Maps::ProvincePoints> provincePoints;
+};
+
+
+// reads one row of the province map as packed colors and the provinces for those colors
+void readRow(const bitmap_image& provinceMap,
+	 const unsigned int y,
+	 const Maps::ProvinceDefinitions& provinceDefinitions,
+	 std::vector<int>& colors,
+	 std::vector<int>& provinces)
 {
-	if (position.second > 0)
+	int lastColor = -1;
+	int lastProvince = noProvince;
+	for (unsigned int x = 0; x < provinceMap.width(); x++)
 	{
-		position.second--;
-	}
+		rgb_t color{0, 0, 0};
+		provinceMap.get_pixel(x, y, color);
 
-	rgb_t color{0, 0, 0};
-	provinceMap.get_pixel(position.first, position.second, color);
+		const int packedColor = (color.red << 16) + (color.green << 8) + color.blue;
+		if (packedColor != lastColor)
+		{
+			lastColor = packedColor;
+			lastProvince = provinceDefinitions.getProvinceFromColor(packedColor).value_or(noProvince);
+		}
 
-	return commonItems::Color(std::array<int, 3>{color.red, color.green, color.blue});
+		colors[x] = packedColor;
+		provinces[x] = lastProvince;
+	}
 }
 
 
-commonItems::Color getBelowColor(Maps::Point position, const unsigned int height, const bitmap_image& provinceMap)
+void addPointToBorder(std::map<int, Maps::bordersWith>& borders,
+	 const int mainProvince,
+	 const int neighborProvince,
+	 const Maps::Point position)
 {
-	if (position.second < height - 1)
+	auto& border = borders[mainProvince][neighborProvince];
+	if (border.empty() || border.back() != position)
 	{
-		position.second++;
+		border.push_back(position);
 	}
-
-	rgb_t color{0, 0, 0};
-	provinceMap.get_pixel(position.first, position.second, color);
-
-	return commonItems::Color(std::array<int, 3>{color.red, color.green, color.blue});
 }
 
 
-commonItems::Color getLeftColor(Maps::Point position, const unsigned int width, const bitmap_image& provinceMap)
+void handleNeighbor(ProvinceMapStripe& stripe,
+	 const int centerColor,
+	 const int otherColor,
+	 const int centerProvince,
+	 const int otherProvince,
+	 const Maps::Point& position)
 {
-	if (position.first > 0)
+	if (centerColor == otherColor)
 	{
-		position.first--;
+		return;
 	}
-	else
+	if (centerProvince == noProvince || otherProvince == noProvince)
 	{
-		position.first = width - 1;
+		return;
 	}
 
-	rgb_t color{0, 0, 0};
-	provinceMap.get_pixel(position.first, position.second, color);
-
-	return commonItems::Color(std::array<int, 3>{color.red, color.green, color.blue});
+	stripe.provinceNeighbors[centerProvince].insert(otherProvince);
+	addPointToBorder(stripe.borders, centerProvince, otherProvince, position);
 }
 
 
-commonItems::Color getRightColor(Maps::Point position, const unsigned int width, const bitmap_image& provinceMap)
+// Scans rows [firstRow, lastRow) of the province map. Provinces are recorded in the raster, which is safe to share
+// between stripes because each stripe writes only its own rows.
+ProvinceMapStripe scanStripe(const bitmap_image& provinceMap,
+	 const Maps::ProvinceDefinitions& provinceDefinitions,
+	 const unsigned int firstRow,
+	 const unsigned int lastRow,
+	 std::vector<int>& provinceRaster)
 {
-	if (position.first < width - 1)
-	{
-		position.first++;
-	}
-	else
+	ProvinceMapStripe stripe;
+
+	const auto height = provinceMap.height();
+	const auto width = provinceMap.width();
+
+	std::vector<int> aboveColors(width);
+	std::vector<int> aboveProvinces(width);
+	std::vector<int> centerColors(width);
+	std::vector<int> centerProvinces(width);
+	std::vector<int> belowColors(width);
+	std::vector<int> belowProvinces(width);
+
+	// rows at the top and bottom of the map are their own neighbors
+	readRow(provinceMap, firstRow > 0 ? firstRow - 1 : firstRow, provinceDefinitions, aboveColors, aboveProvinces);
+	readRow(provinceMap, firstRow, provinceDefinitions, centerColors, centerProvinces);
+	for (unsigned int y = firstRow; y < lastRow; y++)
 	{
-		position.first = 0;
-	}
+		readRow(provinceMap, y < height - 1 ? y + 1 : y, provinceDefinitions, belowColors, belowProvinces);
 
-	rgb_t color{0, 0, 0};
-	provinceMap.get_pixel(position.first, position.second, color);
+		const auto flippedY = static_cast<int>(height - y - 1);
+		for (unsigned int x = 0; x < width; x++)
+		{
+			// the map wraps around horizontally
+			const auto right = x < width - 1 ? x + 1 : 0;
+			const auto left = x > 0 ? x - 1 : width - 1;
+
+			const Maps::Point position = {static_cast<int>(x), flippedY};
+			const auto centerColor = centerColors[x];
+			const auto centerProvince = centerProvinces[x];
+			handleNeighbor(stripe, centerColor, aboveColors[x], centerProvince, aboveProvinces[x], position);
+			handleNeighbor(stripe, centerColor, centerColors[right], centerProvince, centerProvinces[right], position);
+			handleNeighbor(stripe, centerColor, belowColors[x], centerProvince, belowProvinces[x], position);
+			handleNeighbor(stripe, centerColor, centerColors[left], centerProvince, centerProvinces[left], position);
+		}
+
+		std::ranges::copy(centerProvinces, provinceRaster.begin() + static_cast<size_t>(flippedY) * width);
 
-	return commonItems::Color(std::array<int, 3>{color.red, color.green, color.blue});
+		unsigned int x = 0;
+		while (x < width)
+		{
+			const int province = centerProvinces[x];
+			const auto startX = x;
+			while (x < width && centerProvinces[x] == province)
+			{
+				x++;
+			}
+			if (province == noProvince)
+			{
+				continue;
+			}
+
+			stripe.provincePoints[province].addRun(flippedY, static_cast<int>(startX), static_cast<int>(x - 1));
+		}
+
+		std::swap(aboveColors, centerColors);
+		std::swap(aboveProvinces, centerProvinces);
+		std::swap(centerColors, belowColors);
+		std::swap(centerProvinces, belowProvinces);
+	}
+
+	return stripe;
 }
 
 } // namespace
@@ -93,7 +169,9 @@ Maps::MapData::MapData(const ProvinceDefinitions& provinceDefinitions, const std
 	}
 
 	importProvinces(provinceMap);
+	findCentermostPoints();
 	importAdjacencies(path);
+	buildNeighborGraph();
 }
 
 
@@ -101,66 +179,66 @@ void Maps::MapData::importProvinces(const bitmap_image& provinceMap)
 {
 	const auto height = provinceMap.height();
 	const auto width = provinceMap.width();
-	for (unsigned int y = 0; y < height; y++)
-	{
-		for (unsigned int x = 0; x < width; x++)
-		{
-			Point position = {x, y};
+	width_ = static_cast<int>(width);
+	height_ = static_cast<int>(height);
+	provinceRaster_.assign(static_cast<size_t>(width) * height, noProvince);
 
-			auto centerColor = getCenterColor(position, provinceMap);
-			auto aboveColor = getAboveColor(position, provinceMap);
-			auto belowColor = getBelowColor(position, height, provinceMap);
-			auto leftColor = getLeftColor(position, width, provinceMap);
-			auto rightColor = getRightColor(position, width, provinceMap);
+	const auto numStripes = std::clamp(std::thread::hardware_concurrency(), 1U, std::max(height, 1U));
+	const auto rowsPerStripe = (height + numStripes - 1) / numStripes;
 
-			position.second = height - y - 1;
-			if (centerColor != aboveColor)
-			{
-				handleNeighbor(centerColor, aboveColor, position);
-			}
-			if (centerColor != rightColor)
-			{
-				handleNeighbor(centerColor, rightColor, position);
-			}
-			if (centerColor != belowColor)
-			{
-				handleNeighbor(centerColor, belowColor, position);
-			}
-			if (centerColor != leftColor)
-			{
-				handleNeighbor(centerColor, leftColor, position);
-			}
+	std::vector<std::future<ProvinceMapStripe>> stripeScans;
+	for (unsigned int firstRow = 0; firstRow < height; firstRow += rowsPerStripe)
+	{
+		const auto lastRow = std::min(firstRow + rowsPerStripe, height);
+		stripeScans.push_back(std::async(std::launch::async,
+			 scanStripe,
+			 std::cref(provinceMap),
+			 std::cref(provinceDefinitions_),
+			 firstRow,
+			 lastRow,
+			 std::ref(provinceRaster_)));
+	}
 
-			if (auto province = provinceDefinitions_.getProvinceFromColor(centerColor); province)
+	// stripes are merged top to bottom, so border points end up in the same order as a single scan of the map
+	for (auto& stripeScan: stripeScans)
+	{
+		auto stripe = stripeScan.get();
+		for (const auto& [province, neighbors]: stripe.provinceNeighbors)
+		{
+			provinceNeighbors[province].insert(neighbors.begin(), neighbors.end());
+		}
+		for (const auto& [province, bordersWithNeighbors]: stripe.borders)
+		{
+			auto& provinceBorders = borders[province];
+			for (const auto& [neighbor, points]: bordersWithNeighbors)
 			{
-				pointsToProvinces_.emplace(position, *province);
-				if (auto specificProvincePoints = theProvincePoints.find(*province);
-					 specificProvincePoints != theProvincePoints.end())
-				{
-					specificProvincePoints->second.addPoint(position);
-				}
-				else
-				{
-					ProvincePoints theNewPoints;
-					theNewPoints.addPoint(position);
-					theProvincePoints.insert(std::make_pair(*province, theNewPoints));
-				}
+				auto& border = provinceBorders[neighbor];
+				border.insert(border.end(), points.begin(), points.end());
 			}
 		}
+		for (const auto& [province, points]: stripe.provincePoints)
+		{
+			theProvincePoints[province].addPoints(points);
+		}
 	}
 }
 
 
-void Maps::MapData::handleNeighbor(const commonItems::Color& centerColor,
-	 const commonItems::Color& otherColor,
-	 const Point& position)
+void Maps::MapData::findCentermostPoints()
 {
-	auto centerProvince = provinceDefinitions_.getProvinceFromColor(centerColor);
-	auto otherProvince = provinceDefinitions_.getProvinceFromColor(otherColor);
-	if (centerProvince && otherProvince)
+	if (theProvincePoints.empty())
 	{
-		addNeighbor(*centerProvince, *otherProvince);
-		addPointToBorder(*centerProvince, *otherProvince, position);
+		return;
+	}
+
+	// province numbers from definition files are never negative
+	centermostPoints_.resize(static_cast<size_t>(std::max(theProvincePoints.rbegin()->first, -1)) + 1);
+	for (const auto& [province, points]: theProvincePoints)
+	{
+		if (province >= 0)
+		{
+			centermostPoints_[province] = points.getCentermostPoint();
+		}
 	}
 }
 
@@ -188,90 +266,67 @@ void Maps::MapData::removeNeighbor(const int mainProvince, const int neighborPro
 }
 
 
-void Maps::MapData::addPointToBorder(int mainProvince, int neighborProvince, const Point position)
+void Maps::MapData::importAdjacencies(const std::string& path)
 {
-	auto bordersWithNeighbors = borders.find(mainProvince);
-	if (bordersWithNeighbors == borders.end())
-	{
-		bordersWith newBordersWithNeighbors;
-		borders.insert(make_pair(mainProvince, newBordersWithNeighbors));
-		bordersWithNeighbors = borders.find(mainProvince);
-	}
-
-	auto border = bordersWithNeighbors->second.find(neighborProvince);
-	if (border == bordersWithNeighbors->second.end())
+	CsvReader adjacencies(path + "/map/adjacencies.csv");
+	while (adjacencies.readRecord())
 	{
-		borderPoints newBorder;
-		bordersWithNeighbors->second.insert(make_pair(neighborProvince, newBorder));
-		border = bordersWithNeighbors->second.find(neighborProvince);
-	}
+		if (adjacencies.getLine().starts_with('#') || adjacencies.getNumFields() < 3)
+		{
+			continue;
+		}
+		if (adjacencies.getField(0) == "From" || adjacencies.getField(0) == "-1")
+		{
+			continue;
+		}
 
-	if (border->second.empty())
-	{
-		border->second.push_back(position);
-	}
-	else
-	{
-		if (const auto lastPoint = border->second.back();
-			 (lastPoint.first != position.first) || (lastPoint.second != position.second))
+		const int firstProvince = adjacencies.getInt(0);
+		const int secondProvince = adjacencies.getInt(1);
+		if (adjacencies.getField(2) != "impassable")
 		{
-			border->second.push_back(position);
+			addNeighbor(firstProvince, secondProvince);
+			addNeighbor(secondProvince, firstProvince);
+		}
+		else
+		{
+			removeNeighbor(firstProvince, secondProvince);
+			removeNeighbor(secondProvince, firstProvince);
 		}
 	}
 }
 
 
-void Maps::MapData::importAdjacencies(const std::string& path)
+void Maps::MapData::buildNeighborGraph()
 {
-	std::ifstream adjacenciesFile(path + "/map/adjacencies.csv");
-	if (!adjacenciesFile.is_open())
-	{
-		throw std::runtime_error("Could not open " + path + "/map/adjacencies.csv");
-	}
+	// province numbers are never negative, so anything else in adjacencies.csv can't be looked up anyways
+	const auto lastProvince = provinceNeighbors.empty() ? -1 : std::max(provinceNeighbors.rbegin()->first, -1);
 
-	while (!adjacenciesFile.eof())
+	neighborOffsets_.assign(static_cast<size_t>(lastProvince) + 2, 0);
+	neighbors_.clear();
+	for (int province = 0; province <= lastProvince; province++)
 	{
-		std::string line;
-		getline(adjacenciesFile, line);
-		if (line.starts_with('#'))
+		neighborOffsets_[province] = static_cast<int>(neighbors_.size());
+		if (const auto neighbors = provinceNeighbors.find(province); neighbors != provinceNeighbors.end())
 		{
-			continue;
-		}
-
-		const std::regex pattern("([^;]*);([^;]*);([^;]*)(.*)\r?");
-		if (std::smatch matches; regex_match(line, matches, pattern))
-		{
-			if (matches[1] == "From" || matches[1] == "-1")
-			{
-				continue;
-			}
-
-			const int firstProvince = std::stoi(matches[1]);
-			const int secondProvince = std::stoi(matches[2]);
-			if (matches[3] != "impassable")
-			{
-				addNeighbor(firstProvince, secondProvince);
-				addNeighbor(secondProvince, firstProvince);
-			}
-			else
-			{
-				removeNeighbor(firstProvince, secondProvince);
-				removeNeighbor(secondProvince, firstProvince);
-			}
+			neighbors_.insert(neighbors_.end(), neighbors->second.begin(), neighbors->second.end());
 		}
 	}
+	neighborOffsets_[lastProvince + 1] = static_cast<int>(neighbors_.size());
+
+	provinceNeighbors.clear();
 }
 
 
-std::set<int> Maps::MapData::getNeighbors(const int province) const
+std::span<const int> Maps::MapData::getNeighbors(const int province) const
 {
-	const auto neighbors = provinceNeighbors.find(province);
-	if (neighbors == provinceNeighbors.end())
+	if (province < 0 || province + 1 >= static_cast<int>(neighborOffsets_.size()))
 	{
 		return {};
 	}
 
-	return neighbors->second;
+	const auto first = neighborOffsets_[province];
+	const auto last = neighborOffsets_[province + 1];
+	return std::span<const int>(neighbors_).subspan(first, last - first);
 }
 
 
@@ -312,12 +367,17 @@ std::optional<Maps::Point> Maps::MapData::getAnyBorderCenter(const int province)
 
 std::optional<int> Maps::MapData::getProvinceNumber(const Point& point) const
 {
-	const auto i = pointsToProvinces_.find(point);
-	if (i == pointsToProvinces_.end())
+	if (point.first < 0 || point.first >= width_ || point.second < 0 || point.second >= height_)
 	{
 		return std::nullopt;
 	}
-	return i->second;
+
+	const auto province = provinceRaster_[static_cast<size_t>(point.second) * width_ + point.first];
+	if (province == noProvince)
+	{
+		return std::nullopt;
+	}
+	return province;
 }
 
 
@@ -329,4 +389,14 @@ std::optional<Maps::ProvincePoints> Maps::MapData::getProvincePoints(const int p
 		return std::nullopt;
 	}
 	return possiblePoints->second;
+}
+
+
+std::optional<Maps::Point> Maps::MapData::getCentermostPoint(const int provinceNum) const
+{
+	if (provinceNum < 0 || provinceNum >= static_cast<int>(centermostPoints_.size()))
+	{
+		return std::nullopt;
+	}
+	return centermostPoints_[provinceNum];
 }
\ No newline at end of file
@@ -10,6 +10,8 @@
 #include <map>
 #include <optional>
 #include <set>
+#include <span>
+#include <vector>
 
 
 
@@ -25,30 +27,39 @@ class MapData
   public:
 	MapData(const ProvinceDefinitions& provinceDefinitions, const std::string& path);
 
-	[[nodiscard]] std::set<int> getNeighbors(int province) const;
+	[[nodiscard]] std::span<const int> getNeighbors(int province) const;
 	[[nodiscard]] std::optional<Point> getSpecifiedBorderCenter(int mainProvince, int neighbor) const;
 	[[nodiscard]] std::optional<Point> getAnyBorderCenter(int province) const;
 	[[nodiscard]] std::optional<int> getProvinceNumber(const Point& point) const;
 
 	[[nodiscard]] std::optional<ProvincePoints> getProvincePoints(int provinceNum) const;
+	[[nodiscard]] std::optional<Point> getCentermostPoint(int provinceNum) const;
 
   private:
 	void importProvinces(const bitmap_image& provinceMap);
-	void handleNeighbor(const commonItems::Color& centerColor,
-		 const commonItems::Color& otherColor,
-		 const Point& position);
 	void addNeighbor(int mainProvince, int neighborProvince);
 	void removeNeighbor(int mainProvince, int neighborProvince);
-	void addPointToBorder(int mainProvince, int neighborProvince, Point position);
 
 	void importAdjacencies(const std::string& path);
+	void buildNeighborGraph();
+	void findCentermostPoints();
 
-	std::map<int, std::set<int>> provinceNeighbors;
+	std::map<int, std::set<int>> provinceNeighbors; // only used while importing, see neighbors_
+
+	// The neighbors of each province in compressed sparse row form: the neighbors of a province are stored in order in
+	// neighbors_, starting at neighborOffsets_[province] and ending before neighborOffsets_[province + 1].
+	std::vector<int> neighborOffsets_;
+	std::vector<int> neighbors_;
 	std::map<int, bordersWith> borders;
 	std::map<int, ProvincePoints> theProvincePoints;
+	std::vector<std::optional<Point>> centermostPoints_; // indexed by province number
 
 	ProvinceDefinitions provinceDefinitions_;
-	std::map<Point, int> pointsToProvinces_;
+
+	// the province number of every pixel, row-major with the y-axis from the bottom. 0 marks pixels with no province
+	std::vector<int> provinceRaster_;
+	int width_ = 0;
+	int height_ = 0;
 };
 
 } // namespace Maps
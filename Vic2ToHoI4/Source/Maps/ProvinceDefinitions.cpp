@@ -1,5 +1,8 @@
 #include "ProvinceDefinitions.h"
 #include "Configuration.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
 
 
 
@@ -11,16 +14,57 @@ int Maps::getIntFromColor(const commonItems::Color& color)
 }
 
 
+void Maps::ProvinceDefinitions::buildColorLookup(const std::map<int, int>& colorToProvinceMap)
+{
+	const auto numSlots = std::bit_ceil(std::max(colorToProvinceMap.size() * 2, size_t{16}));
+	colorLookup_.assign(numSlots, ColorSlot{});
+	colorLookupMask_ = numSlots - 1;
+	colorLookupShift_ = 32 - std::countr_zero(numSlots);
+
+	for (const auto& [colorInt, province]: colorToProvinceMap)
+	{
+		auto slot = getColorSlot(colorInt);
+		while (colorLookup_[slot].colorInt != -1)
+		{
+			slot = (slot + 1) & colorLookupMask_;
+		}
+		colorLookup_[slot] = {colorInt, province};
+	}
+}
+
+
+size_t Maps::ProvinceDefinitions::getColorSlot(const int colorInt) const
+{
+	// Fibonacci hashing spreads the similar colors common in definition files across the table
+	return static_cast<uint32_t>(colorInt) * 0x9E37'79B1U >> colorLookupShift_;
+}
+
+
 std::optional<int> Maps::ProvinceDefinitions::getProvinceFromColor(const commonItems::Color& color) const
 {
-	const auto colorInt = getIntFromColor(color);
+	return getProvinceFromColor(getIntFromColor(color));
+}
+
 
-	const auto mapping = colorToProvinceMap.find(colorInt);
-	if (mapping == colorToProvinceMap.end())
+std::optional<int> Maps::ProvinceDefinitions::getProvinceFromColor(const int colorInt) const
+{
+	if (colorInt < 0 || colorInt > 0xFF'FF'FF)
 	{
 		return std::nullopt;
 	}
-	return mapping->second;
+
+	for (auto slot = getColorSlot(colorInt);; slot = (slot + 1) & colorLookupMask_)
+	{
+		const auto& [slotColor, province] = colorLookup_[slot];
+		if (slotColor == colorInt)
+		{
+			return province;
+		}
+		if (slotColor == -1)
+		{
+			return std::nullopt;
+		}
+	}
 }
 
 
@@ -7,6 +7,7 @@
 #include <map>
 #include <optional>
 #include <set>
+#include <vector>
 
 
 
@@ -25,9 +26,9 @@ class ProvinceDefinitions
 		 std::map<int, std::string> terrain_types,
 		 std::map<int, int> colorToProvinceMap):
 		 landProvinces(std::move(landProvinces)),
-		 seaProvinces(std::move(seaProvinces)), terrain_types_(terrain_types),
-		 colorToProvinceMap(std::move(colorToProvinceMap))
+		 seaProvinces(std::move(seaProvinces)), terrain_types_(terrain_types)
 	{
+		buildColorLookup(colorToProvinceMap);
 	}
 
 	[[nodiscard]] const auto& getLandProvinces() const { return landProvinces; }
@@ -35,14 +36,28 @@ class ProvinceDefinitions
 	[[nodiscard]] bool isSeaProvince(const int province) const { return seaProvinces.contains(province); }
 
 	[[nodiscard]] std::optional<int> getProvinceFromColor(const commonItems::Color& color) const;
+	[[nodiscard]] std::optional<int> getProvinceFromColor(int colorInt) const;
 	[[nodiscard]] std::string getTerrainType(int province) const;
 
   private:
+	struct ColorSlot
+	{
+		int colorInt = -1; // packed colors never have the top byte set, so -1 marks an empty slot
+		int province = 0;
+	};
+
+	void buildColorLookup(const std::map<int, int>& colorToProvinceMap);
+	[[nodiscard]] size_t getColorSlot(int colorInt) const;
+
 	std::set<int> landProvinces;
 	std::set<int> seaProvinces;
 	std::map<int, std::string> terrain_types_;
-	std::map<int, int> colorToProvinceMap; // colors are a packed integer to work around some issues. If you can get
-														// Colors to work directly, please replace this hack.
+
+	// An open-addressed hash table of packed colors, kept at most half full so a lookup almost always touches a single
+	// slot. This is consulted for every pixel of the province maps.
+	std::vector<ColorSlot> colorLookup_;
+	size_t colorLookupMask_ = 0;
+	int colorLookupShift_ = 0;
 };
 
 } // namespace Maps
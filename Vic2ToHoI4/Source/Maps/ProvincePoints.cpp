@@ -1,4 +1,6 @@
 #include "ProvincePoints.h"
+#include <algorithm>
+#include <limits>
 #include <numeric>
 
 
@@ -19,7 +21,40 @@ double calculateDistanceSquared(const Maps::Point point, const Maps::Point cente
 
 void Maps::ProvincePoints::addPoint(const Point& thePoint)
 {
-	thePoints.emplace(thePoint);
+	addRun(thePoint.second, thePoint.first, thePoint.first);
+}
+
+
+void Maps::ProvincePoints::addRun(const int y, const int startX, const int endX)
+{
+	if (!theRuns.empty())
+	{
+		if (auto& lastRun = theRuns.back(); lastRun.y == y && lastRun.endX + 1 == startX)
+		{
+			lastRun.endX = endX;
+			updateBounds({startX, y});
+			updateBounds({endX, y});
+			return;
+		}
+	}
+
+	theRuns.push_back({y, startX, endX});
+	updateBounds({startX, y});
+	updateBounds({endX, y});
+}
+
+
+void Maps::ProvincePoints::addPoints(const ProvincePoints& otherPoints)
+{
+	for (const auto& run: otherPoints.theRuns)
+	{
+		addRun(run.y, run.startX, run.endX);
+	}
+}
+
+
+void Maps::ProvincePoints::updateBounds(const Point& thePoint)
+{
 	if (thePoint.first < leftmostPoint.first)
 	{
 		leftmostPoint = thePoint;
@@ -39,26 +74,37 @@ void Maps::ProvincePoints::addPoint(const Point& thePoint)
 }
 
 
+bool Maps::ProvincePoints::contains(const Point& thePoint) const
+{
+	return std::ranges::any_of(theRuns, [thePoint](const PointRun& run) {
+		return run.y == thePoint.second && run.startX <= thePoint.first && thePoint.first <= run.endX;
+	});
+}
+
+
 Maps::Point Maps::ProvincePoints::getCentermostPoint() const
 {
 	Point possibleCenter;
 	possibleCenter.first = std::midpoint(leftmostPoint.first, rightmostPoint.first);
 	possibleCenter.second = std::midpoint(lowestPoint.second, highestPoint.second);
-	if (thePoints.contains(possibleCenter))
+	if (contains(possibleCenter))
 	{
 		return possibleCenter;
 	}
 
+	// the closest point of a run is the one nearest the center horizontally. Ties go to the lowest point, as if the
+	// points were all checked in sorted order
 	auto shortestDistance = std::numeric_limits<double>::max();
 	Point closestPoint;
-	for (const auto& possiblePoint: thePoints)
+	for (const auto& run: theRuns)
 	{
+		const Point possiblePoint{std::clamp(possibleCenter.first, run.startX, run.endX), run.y};
 		const auto distanceSquared = calculateDistanceSquared(possiblePoint, possibleCenter);
-		if (distanceSquared < shortestDistance)
+		if (distanceSquared < shortestDistance || (distanceSquared == shortestDistance && possiblePoint < closestPoint))
 		{
 			shortestDistance = distanceSquared;
 			closestPoint = possiblePoint;
 		}
 	}
 	return closestPoint;
-}
\ No newline at end of file
+}
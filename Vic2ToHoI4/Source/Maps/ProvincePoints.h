@@ -4,7 +4,8 @@
 
 
 #include <climits>
-#include <set>
+#include <utility>
+#include <vector>
 
 
 
@@ -13,15 +14,31 @@ namespace Maps
 
 using Point = std::pair<int, int>;
 
+
+// a horizontal stretch of pixels belonging to one province, from startX to endX inclusive
+struct PointRun
+{
+	int y = 0;
+	int startX = 0;
+	int endX = 0;
+};
+
+
 class ProvincePoints
 {
   public:
 	void addPoint(const Point& thePoint);
+	void addRun(int y, int startX, int endX);
+	void addPoints(const ProvincePoints& otherPoints);
 
+	[[nodiscard]] bool contains(const Point& thePoint) const;
 	[[nodiscard]] Point getCentermostPoint() const;
 
   private:
-	std::set<Point> thePoints;
+	void updateBounds(const Point& thePoint);
+
+	// points are stored as runs of the province raster rather than individually, which keeps large provinces small
+	std::vector<PointRun> theRuns;
 	Point leftmostPoint = {INT_MAX, 0};
 	Point rightmostPoint = {0, 0};
 	Point highestPoint = {0, 0};
@@ -32,4 +49,4 @@ class ProvincePoints
 
 
 
-#endif // MAPS_PROVINCE_POINTS_H
\ No newline at end of file
+#endif // MAPS_PROVINCE_POINTS_H
@@ -0,0 +1,157 @@
+#include "FlagCache.h"
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+
+
+void HoI4::FlagCacheKey::addText(const std::string_view text)
+{
+	const auto size = text.size();
+	addBytes(&size, sizeof(size));
+	addBytes(text.data(), text.size());
+}
+
+
+void HoI4::FlagCacheKey::addFileHash(const uint64_t fileHash)
+{
+	addBytes(&fileHash, sizeof(fileHash));
+}
+
+
+uint64_t HoI4::FlagCacheKey::hashFile(const std::optional<std::string>& path)
+{
+	FlagCacheKey fileKey;
+
+	std::ifstream file;
+	if (path)
+	{
+		file.open(*path, std::ios::binary);
+	}
+	if (!file.is_open())
+	{
+		constexpr char missing = 0;
+		fileKey.addBytes(&missing, sizeof(missing));
+		return fileKey.hash;
+	}
+
+	const std::vector<char> contents{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+	constexpr char present = 1;
+	fileKey.addBytes(&present, sizeof(present));
+	fileKey.addText({contents.data(), contents.size()});
+	return fileKey.hash;
+}
+
+
+std::string HoI4::FlagCacheKey::getKey() const
+{
+	constexpr std::string_view digits = "0123456789abcdef";
+
+	std::string key;
+	for (auto shift = 60; shift >= 0; shift -= 4)
+	{
+		key += digits[(hash >> shift) & 0xF];
+	}
+	return key;
+}
+
+
+// 64 bit FNV-1a
+void HoI4::FlagCacheKey::addBytes(const void* bytes, const size_t size)
+{
+	const auto* byte = static_cast<const unsigned char*>(bytes);
+	for (size_t i = 0; i < size; ++i)
+	{
+		hash ^= byte[i];
+		hash *= 1099511628211ULL;
+	}
+}
+
+
+bool HoI4::FlagCache::copyFlag(const std::string& key, const std::string& destination)
+{
+	markUsed(key);
+
+	if (!hasFlag(key))
+	{
+		return false;
+	}
+
+	// an existing file is replaced rather than written over, as it may be linked to another cached flag
+	std::error_code error;
+	std::filesystem::remove(destination, error);
+	std::filesystem::create_hard_link(getPath(key), destination, error);
+	if (!error)
+	{
+		return true;
+	}
+
+	error.clear();
+	return std::filesystem::copy_file(getPath(key), destination, error);
+}
+
+
+bool HoI4::FlagCache::hasFlag(const std::string& key) const
+{
+	std::error_code error;
+	return std::filesystem::is_regular_file(getPath(key), error);
+}
+
+
+void HoI4::FlagCache::storeFlag(const std::string& key, const std::string& source)
+{
+	markUsed(key);
+
+	// flag workers can store the same flag at once, so each writes its own file and renames it into place
+	const auto path = getPath(key);
+	const auto temporaryPath = path + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+	std::error_code error;
+	std::filesystem::remove(temporaryPath, error);
+	std::filesystem::create_hard_link(source, temporaryPath, error);
+	if (error)
+	{
+		error.clear();
+		std::filesystem::copy_file(source, temporaryPath, error);
+	}
+	if (!error)
+	{
+		std::filesystem::rename(temporaryPath, path, error);
+	}
+
+	// renaming onto a link to the same file leaves the temporary file in place
+	std::filesystem::remove(temporaryPath, error);
+}
+
+
+void HoI4::FlagCache::removeUnusedFlags()
+{
+	std::scoped_lock lock(usedKeysMutex);
+
+	std::error_code error;
+	std::vector<std::filesystem::path> unusedFiles;
+	for (const auto& entry: std::filesystem::directory_iterator(folder, error))
+	{
+		// anything else in the folder, such as a temporary file left by an interrupted conversion, is unused too
+		const auto& path = entry.path();
+		if (path.extension() != ".tga" || !usedKeys.contains(path.stem().string()))
+		{
+			unusedFiles.push_back(path);
+		}
+	}
+
+	for (const auto& path: unusedFiles)
+	{
+		std::filesystem::remove(path, error);
+	}
+}
+
+
+void HoI4::FlagCache::markUsed(const std::string& key)
+{
+	std::scoped_lock lock(usedKeysMutex);
+	usedKeys.insert(key);
+}
@@ -0,0 +1,71 @@
+#ifndef OUT_FLAGS_FLAG_CACHE_H
+#define OUT_FLAGS_FLAG_CACHE_H
+
+
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+
+
+namespace HoI4
+{
+
+// Identifies a flag by the contents of everything it's made from, so a flag whose inputs haven't changed can be reused
+class FlagCacheKey
+{
+  public:
+	void addText(std::string_view text);
+	// a missing or unreadable file is hashed as such, so it's distinct from an empty one
+	void addFile(const std::optional<std::string>& path) { addFileHash(hashFile(path)); }
+	// for files used by many flags, which can be hashed once with hashFile
+	void addFileHash(uint64_t fileHash);
+
+	[[nodiscard]] static uint64_t hashFile(const std::optional<std::string>& path);
+
+	[[nodiscard]] std::string getKey() const;
+
+  private:
+	void addBytes(const void* bytes, size_t size);
+
+	uint64_t hash = 14695981039346656037ULL;
+};
+
+
+// Flags made by earlier conversions, stored in a folder under their keys. Files are shared with the output by hard
+// links where the filesystem allows, and copied where it doesn't. Flags can be copied and stored from several threads
+// at once.
+class FlagCache
+{
+  public:
+	explicit FlagCache(std::string folder): folder(std::move(folder)) {}
+
+	// false if the cached file doesn't exist or couldn't be linked or copied
+	[[nodiscard]] bool copyFlag(const std::string& key, const std::string& destination);
+	[[nodiscard]] bool hasFlag(const std::string& key) const;
+	// failing to store a flag only means it will be made again, so errors are ignored
+	void storeFlag(const std::string& key, const std::string& source);
+
+	// Removes every flag that wasn't copied or stored since the cache was opened, so the cache holds one conversion's
+	// flags rather than growing with each one
+	void removeUnusedFlags();
+
+  private:
+	[[nodiscard]] std::string getPath(const std::string& key) const { return folder + "/" + key + ".tga"; }
+	void markUsed(const std::string& key);
+
+	std::string folder;
+
+	std::mutex usedKeysMutex;
+	std::unordered_set<std::string> usedKeys;
+};
+
+} // namespace HoI4
+
+
+
+#endif // OUT_FLAGS_FLAG_CACHE_H
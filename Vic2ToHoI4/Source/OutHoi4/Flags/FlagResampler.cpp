@@ -0,0 +1,199 @@
+#include "FlagResampler.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+
+
+namespace
+{
+
+// the alpha byte of a BGRA pixel read as one word, whatever the platform's byte order
+constexpr auto opaqueAlpha = std::bit_cast<uint32_t>(std::array<uint8_t, 4>{0x00, 0x00, 0x00, 0xFF});
+
+
+// the source pixels along one axis that an output pixel covers
+struct SourceSpan
+{
+	unsigned int start;
+	unsigned int end;
+};
+
+
+struct Output
+{
+	HoI4::FlagSize size;
+	std::vector<SourceSpan> columns;
+	std::vector<SourceSpan> rows;
+	unsigned int nextRow = 0;
+	std::vector<uint32_t> boxSums;
+	std::vector<uint8_t> image;
+};
+
+
+// Output pixel i starts at source pixel i * sourceLength / outputLength. The position is stepped in whole pixels plus a
+// remainder, so there's no division per pixel and none of the rounding error of stepping by a fraction.
+std::vector<SourceSpan> makeSourceSpans(const unsigned int sourceLength, const unsigned int outputLength)
+{
+	std::vector<SourceSpan> spans(outputLength);
+	if (outputLength == 0)
+	{
+		return spans;
+	}
+
+	const auto wholeStep = sourceLength / outputLength;
+	const auto remainderStep = sourceLength % outputLength;
+	unsigned int position = 0;
+	unsigned int remainder = 0;
+	for (auto& span: spans)
+	{
+		span.start = position;
+		position += wholeStep;
+		remainder += remainderStep;
+		if (remainder >= outputLength)
+		{
+			++position;
+			remainder -= outputLength;
+		}
+		span.end = std::max(position, span.start + 1);
+	}
+
+	return spans;
+}
+
+
+// Each pixel is moved as one word, with the alpha set in the same operation, instead of channel by channel
+template <unsigned int bytesPerPixel> void copyNearestRow(const uint8_t* sourceRow, Output& output)
+{
+	auto* destination = output.image.data() + static_cast<size_t>(output.nextRow) * output.size.width * 4;
+	for (const auto& column: output.columns)
+	{
+		uint32_t pixel = 0;
+		std::memcpy(&pixel, sourceRow + column.start * bytesPerPixel, bytesPerPixel);
+		pixel |= opaqueAlpha;
+		std::memcpy(destination, &pixel, 4);
+		destination += 4;
+	}
+}
+
+
+void copyNearestRow(const uint8_t* sourceRow, const unsigned int sourceBytesPerPixel, Output& output)
+{
+	if (sourceBytesPerPixel == 4)
+	{
+		copyNearestRow<4>(sourceRow, output);
+	}
+	else
+	{
+		copyNearestRow<3>(sourceRow, output);
+	}
+}
+
+
+void addToBoxSums(const uint8_t* sourceRow, const unsigned int sourceBytesPerPixel, Output& output)
+{
+	auto sum = output.boxSums.begin();
+	for (const auto& column: output.columns)
+	{
+		for (auto x = column.start; x < column.end; ++x)
+		{
+			const auto* pixel = sourceRow + x * sourceBytesPerPixel;
+			sum[0] += pixel[0];
+			sum[1] += pixel[1];
+			sum[2] += pixel[2];
+		}
+		sum += 3;
+	}
+}
+
+
+void writeBoxRow(Output& output)
+{
+	const auto& row = output.rows[output.nextRow];
+	auto* destination = output.image.data() + static_cast<size_t>(output.nextRow) * output.size.width * 4;
+	auto sum = output.boxSums.begin();
+	for (const auto& column: output.columns)
+	{
+		const auto count = (column.end - column.start) * (row.end - row.start);
+		destination[0] = static_cast<uint8_t>((sum[0] + count / 2) / count);
+		destination[1] = static_cast<uint8_t>((sum[1] + count / 2) / count);
+		destination[2] = static_cast<uint8_t>((sum[2] + count / 2) / count);
+		destination[3] = 0xFF;
+		destination += 4;
+		sum += 3;
+	}
+
+	std::fill(output.boxSums.begin(), output.boxSums.end(), 0);
+}
+
+} // namespace
+
+
+
+std::vector<std::vector<uint8_t>> HoI4::resampleFlag(const uint8_t* sourceData,
+	 const unsigned int sourceWidth,
+	 const unsigned int sourceHeight,
+	 const unsigned int sourceBytesPerPixel,
+	 const std::vector<FlagSize>& sizes)
+{
+	if (sourceBytesPerPixel != 3 && sourceBytesPerPixel != 4)
+	{
+		throw std::runtime_error("Flags must be 24 or 32 bit, not " + std::to_string(sourceBytesPerPixel * 8) + " bit");
+	}
+	if (sourceWidth == 0 || sourceHeight == 0)
+	{
+		throw std::runtime_error("Cannot resize an empty flag");
+	}
+
+	std::vector<Output> outputs;
+	for (const auto& size: sizes)
+	{
+		Output output{.size = size,
+			 .columns = makeSourceSpans(sourceWidth, size.width),
+			 .rows = makeSourceSpans(sourceHeight, size.height)};
+		if (size.filter == ResampleFilter::Box)
+		{
+			output.boxSums.resize(static_cast<size_t>(size.width) * 3);
+		}
+		output.image.resize(static_cast<size_t>(size.width) * size.height * 4);
+		outputs.push_back(std::move(output));
+	}
+
+	// every output row is made while the source rows it needs are the ones being read
+	const auto sourceRowBytes = static_cast<size_t>(sourceWidth) * sourceBytesPerPixel;
+	for (unsigned int sourceY = 0; sourceY < sourceHeight; ++sourceY)
+	{
+		const auto* sourceRow = sourceData + sourceY * sourceRowBytes;
+		for (auto& output: outputs)
+		{
+			// when enlarging, several output rows start on the same source row
+			while (output.nextRow < output.rows.size() && output.rows[output.nextRow].start <= sourceY)
+			{
+				if (output.size.filter == ResampleFilter::Nearest)
+				{
+					copyNearestRow(sourceRow, sourceBytesPerPixel, output);
+				}
+				else
+				{
+					addToBoxSums(sourceRow, sourceBytesPerPixel, output);
+					if (sourceY + 1 < output.rows[output.nextRow].end)
+					{
+						break;
+					}
+					writeBoxRow(output);
+				}
+				++output.nextRow;
+			}
+		}
+	}
+
+	std::vector<std::vector<uint8_t>> images;
+	for (auto& output: outputs)
+	{
+		images.push_back(std::move(output.image));
+	}
+	return images;
+}
@@ -0,0 +1,41 @@
+#ifndef OUT_FLAGS_FLAG_RESAMPLER_H
+#define OUT_FLAGS_FLAG_RESAMPLER_H
+
+
+
+#include <cstdint>
+#include <vector>
+
+
+
+namespace HoI4
+{
+
+enum class ResampleFilter
+{
+	Nearest, // each output pixel copies the source pixel at its top left corner
+	Box,		// each output pixel averages the source pixels it covers
+};
+
+
+struct FlagSize
+{
+	unsigned int width;
+	unsigned int height;
+	ResampleFilter filter = ResampleFilter::Nearest;
+};
+
+
+// Resizes a 24 or 32 bit BGR(A) image to each of the given sizes, reading the source only once. The results are 32 bit
+// BGRA images with opaque alpha, in the order of the sizes.
+[[nodiscard]] std::vector<std::vector<uint8_t>> resampleFlag(const uint8_t* sourceData,
+	 unsigned int sourceWidth,
+	 unsigned int sourceHeight,
+	 unsigned int sourceBytesPerPixel,
+	 const std::vector<FlagSize>& sizes);
+
+} // namespace HoI4
+
+
+
+#endif // OUT_FLAGS_FLAG_RESAMPLER_H
@@ -1,42 +1,91 @@
 #include "OutFlags.h"
+#include "Flags/FlagCache.h"
+#include "Flags/FlagResampler.h"
 #include "HOI4World/HoI4Country.h"
+#include "LoadedResources.h"
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
 #include "V2World/Countries/Country.h"
 #include "targa.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <exception>
+#include <future>
+#include <memory>
 #include <optional>
+#include <ranges>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 
 
 namespace HoI4
 {
 
+std::unordered_set<std::string> indexFlagFiles(const Mods& vic2Mods);
+std::string getFlagFileKey(std::string path);
+// Flags are made on several threads, so warnings are collected per country and logged once all flags are done
 void processFlagsForCountry(const std::string&,
 	 const Country& country,
 	 const std::string& outputName,
 	 const Mods& vic2Mods,
-	 const std::set<std::string>& majorIdeologies);
-std::optional<tga_image*> createDominionFlag(const std::string& hoi4Suffix,
-	 const std::string& vic2Suffix,
-	 const std::string& overlord,
+	 const std::unordered_set<std::string>& flagFiles,
+	 FlagCache& flagCache,
+	 LoadedResources<tga_image>& decodedFlags,
+	 LoadedResources<uint64_t>& fileHashes,
+	 const std::unordered_set<std::string>& overlordTags,
+	 const std::set<std::string>& majorIdeologies,
+	 std::vector<std::string>& warnings);
+void addFileToCacheKey(FlagCacheKey& cacheKey,
+	 const std::optional<std::string>& path,
+	 LoadedResources<uint64_t>& fileHashes);
+std::shared_ptr<const tga_image> createDominionFlag(const std::string& hoi4Suffix,
+	 const std::optional<std::string>& overlordFlagPath,
 	 const std::string& region,
-	 const Mods& vic2Mods);
+	 LoadedResources<tga_image>& decodedFlags,
+	 std::vector<std::string>& warnings);
 std::tuple<uint8_t, uint8_t, uint8_t> getDominionFlagBaseColor(std::string_view hoi4Suffix);
-std::optional<tga_image*> createUnrecognizedNationFlag(const std::string& hoi4Suffix,
+std::shared_ptr<const tga_image> createUnrecognizedNationFlag(const std::string& hoi4Suffix,
 	 const std::string& vic2Suffix,
 	 const std::string& region,
-	 const Mods& vic2Mods);
-std::optional<tga_image*> readFlag(const std::string& path);
-tga_image* createNewFlag(const tga_image* sourceFlag, unsigned int sizeX, unsigned int sizeY);
-void createBigFlag(const tga_image* sourceFlag, const std::string& filename, const std::string& outputName);
-void createMediumFlag(const tga_image* sourceFlag, const std::string& filename, const std::string& outputName);
-void createSmallFlag(const tga_image* sourceFlag, const std::string& filename, const std::string& outputName);
+	 const Mods& vic2Mods,
+	 LoadedResources<tga_image>& decodedFlags,
+	 std::vector<std::string>& warnings);
+std::string getEmblemPath(const std::string& region);
+std::optional<tga_image*> readFlag(const std::string& path, std::vector<std::string>& warnings);
+std::shared_ptr<const tga_image> readDecodedFlag(const std::string& path,
+	 LoadedResources<tga_image>& decodedFlags,
+	 std::vector<std::string>& warnings);
+std::shared_ptr<const tga_image> shareFlag(tga_image* flag);
+bool copyCachedFlags(FlagCache& flagCache,
+	 const std::string& cacheKey,
+	 const std::string& filename,
+	 const std::string& outputName);
+void storeFlagsInCache(FlagCache& flagCache,
+	 const std::string& cacheKey,
+	 const std::string& filename,
+	 const std::string& outputName);
+std::string getSizeCacheKey(const std::string& cacheKey, const FlagSize& size);
+void createFlags(const tga_image* sourceFlag,
+	 const std::string& filename,
+	 const std::string& outputName,
+	 std::vector<std::string>& warnings);
+void writeFlag(std::vector<uint8_t>& imageData, const FlagSize& size, const std::string& path);
 std::optional<std::string> getSourceFlagPath(const std::string& Vic2Tag,
 	 const std::string& sourceSuffix,
-	 const Mods& vic2Mods);
+	 const Mods& vic2Mods,
+	 const std::unordered_set<std::string>& flagFiles,
+	 std::vector<std::string>& warnings);
 bool isThisAConvertedTag(const std::string& Vic2Tag);
-std::optional<std::string> getConversionModFlag(const std::string& flagFilename, const Mods& vic2Mods);
-std::optional<std::string> getAllowModFlags(const std::string& flagFilename, const Mods& vic2Mods);
+std::optional<std::string> getConversionModFlag(const std::string& flagFilename,
+	 const Mods& vic2Mods,
+	 const std::unordered_set<std::string>& flagFiles);
+std::optional<std::string> getAllowModFlags(const std::string& flagFilename,
+	 const Mods& vic2Mods,
+	 const std::unordered_set<std::string>& flagFiles);
 
 } // namespace HoI4
 
@@ -66,10 +115,88 @@ void HoI4::copyFlags(const std::map<std::string, std::shared_ptr<Country>>& coun
 		throw std::runtime_error("Could not create output/" + outputName + "/gfx/flags/small");
 	}
 
+	const auto flagFiles = indexFlagFiles(vic2Mods);
+
+	// the cache is kept between conversions, and only saves time, so it's fine if it can't be created
+	commonItems::TryCreateFolder("output/flagcache");
+	FlagCache flagCache("output/flagcache");
+
+	// Emblems and overlord flags are used by many generated flags, so each is decoded once and kept until every flag is
+	// made, and an overlord's own flags are made from those same copies. Other countries' flags are each used once, so
+	// they aren't kept.
+	LoadedResources<tga_image> decodedFlags;
+	std::unordered_set<std::string> overlordTags;
+	for (const auto& country: countries | std::views::values)
+	{
+		if (country->isGeneratedDominion())
+		{
+			overlordTags.insert(country->getPuppetMasterOldTag());
+		}
+	}
+	// likewise each file's contents are hashed once for the cache keys of all the flags made from it
+	LoadedResources<uint64_t> fileHashes;
+
+	struct CountryFlags
+	{
+		const std::string& tag;
+		const Country& country;
+		std::vector<std::string> warnings;
+		std::exception_ptr error;
+	};
+	std::vector<CountryFlags> allCountryFlags;
 	for (const auto& [tag, country]: countries)
 	{
-		processFlagsForCountry(tag, *country, outputName, vic2Mods, majorIdeologies);
+		allCountryFlags.push_back({tag, *country, {}, nullptr});
+	}
+
+	// workers take the next country as they finish one, since dominion flags take longer than the rest
+	std::atomic<size_t> nextCountry = 0;
+	std::vector<std::future<void>> workers;
+	for (unsigned int worker = 0; worker < std::max(std::thread::hardware_concurrency(), 1U); ++worker)
+	{
+		workers.push_back(std::async(std::launch::async, [&] {
+			for (auto i = nextCountry++; i < allCountryFlags.size(); i = nextCountry++)
+			{
+				auto& countryFlags = allCountryFlags[i];
+				try
+				{
+					processFlagsForCountry(countryFlags.tag,
+						 countryFlags.country,
+						 outputName,
+						 vic2Mods,
+						 flagFiles,
+						 flagCache,
+						 decodedFlags,
+						 fileHashes,
+						 overlordTags,
+						 majorIdeologies,
+						 countryFlags.warnings);
+				}
+				catch (...)
+				{
+					countryFlags.error = std::current_exception();
+				}
+			}
+		}));
+	}
+	for (auto& worker: workers)
+	{
+		worker.get();
 	}
+
+	for (const auto& countryFlags: allCountryFlags)
+	{
+		for (const auto& warning: countryFlags.warnings)
+		{
+			Log(LogLevel::Warning) << warning;
+		}
+		if (countryFlags.error)
+		{
+			std::rethrow_exception(countryFlags.error);
+		}
+	}
+
+	flagCache.removeUnusedFlags();
 }
 
 
@@ -95,17 +222,62 @@ constexpr std::array<const char*, numFlagsPerCountry> hoi4Suffixes{
 	 "_radical.tga",	  // radical flag
 };
 
+// big, medium and small flags, all made from one pass over the source flag
+const std::vector<HoI4::FlagSize> flagSizes{{82, 52}, {41, 26}, {10, 7}};
+constexpr std::array flagFolders{"/gfx/flags/", "/gfx/flags/medium/", "/gfx/flags/small/"};
+
+// change this when flags start being made differently, so flags cached by older versions aren't used
+constexpr std::string_view flagCacheVersion = "1";
+
 static std::set<std::string> allowedMods = {"POPs of Darkness",
 	 "New Nations Mod",
 	 "Divergences of Darkness",
 	 "The Concert of Europe"};
 
 
+// The flags the converter and mods provide, listed once so that finding a country's flag doesn't have to go to disk
+std::unordered_set<std::string> HoI4::indexFlagFiles(const Mods& vic2Mods)
+{
+	std::unordered_set<std::string> flagFiles;
+	for (const auto& file: commonItems::GetAllFilesInFolder("flags"))
+	{
+		flagFiles.insert(getFlagFileKey("flags/" + file));
+	}
+	for (const auto& mod: vic2Mods)
+	{
+		for (const auto& file: commonItems::GetAllFilesInFolder(mod.path + "/gfx/flags"))
+		{
+			flagFiles.insert(getFlagFileKey(mod.path + "/gfx/flags/" + file));
+		}
+	}
+
+	return flagFiles;
+}
+
+
+// DoesFileExist ignores case where the filesystem does, so the index has to as well
+std::string HoI4::getFlagFileKey(std::string path)
+{
+#if defined(_WIN32) || defined(__APPLE__)
+	std::ranges::transform(path, path.begin(), [](const unsigned char character) {
+		return static_cast<char>(std::tolower(character));
+	});
+#endif
+	return path;
+}
+
+
 void HoI4::processFlagsForCountry(const std::string& tag,
 	 const Country& country,
 	 const std::string& outputName,
 	 const Mods& vic2Mods,
-	 const std::set<std::string>& majorIdeologies)
+	 const std::unordered_set<std::string>& flagFiles,
+	 FlagCache& flagCache,
+	 LoadedResources<tga_image>& decodedFlags,
+	 LoadedResources<uint64_t>& fileHashes,
+	 const std::unordered_set<std::string>& overlordTags,
+	 const std::set<std::string>& majorIdeologies,
+	 std::vector<std::string>& warnings)
 {
 	for (size_t i = 0; i < numFlagsPerCountry; i++)
 	{
@@ -114,29 +286,64 @@ void HoI4::processFlagsForCountry(const std::string& tag,
 			continue;
 		}
 
-		std::optional<tga_image*> sourceFlag;
-
+		// the cache key covers everything the flag is made from
+		FlagCacheKey cacheKey;
+		cacheKey.addText(flagCacheVersion);
+		std::optional<std::string> sourcePath;
 		if (country.isGeneratedDominion())
 		{
-			sourceFlag = createDominionFlag(hoi4Suffixes[i],
-				 vic2Suffixes[i],
-				 country.getPuppetMasterOldTag(),
-				 country.getRegion(),
-				 vic2Mods);
+			sourcePath =
+				 getSourceFlagPath(country.getPuppetMasterOldTag(), vic2Suffixes[i], vic2Mods, flagFiles, warnings);
+			const auto [r, g, b] = getDominionFlagBaseColor(hoi4Suffixes[i]);
+			cacheKey.addText("dominion");
+			cacheKey.addText(std::string{static_cast<char>(r), static_cast<char>(g), static_cast<char>(b)});
+			addFileToCacheKey(cacheKey, sourcePath, fileHashes);
+			addFileToCacheKey(cacheKey, getEmblemPath(country.getRegion()), fileHashes);
 		}
 		else if (country.isUnrecognizedNation())
 		{
-			sourceFlag = createUnrecognizedNationFlag(hoi4Suffixes[i], vic2Suffixes[i], country.getRegion(), vic2Mods);
+			cacheKey.addText("unrecognized nation");
+			addFileToCacheKey(cacheKey, getEmblemPath(country.getRegion()), fileHashes);
 		}
 		else
 		{
-			const auto sourcePath = getSourceFlagPath(country.getOldTag(), vic2Suffixes[i], vic2Mods);
+			sourcePath = getSourceFlagPath(country.getOldTag(), vic2Suffixes[i], vic2Mods, flagFiles, warnings);
 			if (!sourcePath)
 			{
 				continue;
 			}
+			cacheKey.addText("flag");
+			addFileToCacheKey(cacheKey, sourcePath, fileHashes);
+		}
 
-			sourceFlag = readFlag(*sourcePath);
+		const auto filename = tag + hoi4Suffixes[i];
+		if (copyCachedFlags(flagCache, cacheKey.getKey(), filename, outputName))
+		{
+			continue;
+		}
+
+		const auto numWarnings = warnings.size();
+		std::shared_ptr<const tga_image> sourceFlag;
+		if (country.isGeneratedDominion())
+		{
+			sourceFlag = createDominionFlag(hoi4Suffixes[i], sourcePath, country.getRegion(), decodedFlags, warnings);
+		}
+		else if (country.isUnrecognizedNation())
+		{
+			sourceFlag = createUnrecognizedNationFlag(hoi4Suffixes[i],
+				 vic2Suffixes[i],
+				 country.getRegion(),
+				 vic2Mods,
+				 decodedFlags,
+				 warnings);
+		}
+		else if (overlordTags.contains(country.getOldTag()))
+		{
+			sourceFlag = readDecodedFlag(*sourcePath, decodedFlags, warnings);
+		}
+		else if (const auto flag = readFlag(*sourcePath, warnings); flag)
+		{
+			sourceFlag = shareFlag(*flag);
 		}
 
 		if (!sourceFlag)
@@ -144,57 +351,73 @@ void HoI4::processFlagsForCountry(const std::string& tag,
 			continue;
 		}
 
-		createBigFlag(*sourceFlag, tag + hoi4Suffixes[i], outputName);
-		createMediumFlag(*sourceFlag, tag + hoi4Suffixes[i], outputName);
-		createSmallFlag(*sourceFlag, tag + hoi4Suffixes[i], outputName);
+		createFlags(sourceFlag.get(), filename, outputName, warnings);
 
-		tga_free_buffers(*sourceFlag);
-		delete *sourceFlag;
+		// flags made despite problems would hide those problems' warnings when reused, so they aren't cached
+		if (warnings.size() == numWarnings)
+		{
+			storeFlagsInCache(flagCache, cacheKey.getKey(), filename, outputName);
+		}
 	}
 }
 
 
+void HoI4::addFileToCacheKey(FlagCacheKey& cacheKey,
+	 const std::optional<std::string>& path,
+	 LoadedResources<uint64_t>& fileHashes)
+{
+	if (!path)
+	{
+		cacheKey.addFile(std::nullopt);
+		return;
+	}
+
+	cacheKey.addFileHash(*fileHashes.get(*path, [&path] {
+		return std::make_shared<const uint64_t>(FlagCacheKey::hashFile(path));
+	}));
+}
+
+
 std::optional<std::string> HoI4::getSourceFlagPath(const std::string& Vic2Tag,
 	 const std::string& sourceSuffix,
-	 const Mods& vic2Mods)
+	 const Mods& vic2Mods,
+	 const std::unordered_set<std::string>& flagFiles,
+	 std::vector<std::string>& warnings)
 {
 	auto path = "flags/" + Vic2Tag + sourceSuffix;
-	if (commonItems::DoesFileExist(path))
+	if (flagFiles.contains(getFlagFileKey(path)))
 	{
 		return path;
 	}
 
 	if (isThisAConvertedTag(Vic2Tag))
 	{
-		if (auto possiblePath = getConversionModFlag(Vic2Tag + sourceSuffix, vic2Mods);
-			 possiblePath && commonItems::DoesFileExist(*possiblePath))
+		if (auto possiblePath = getConversionModFlag(Vic2Tag + sourceSuffix, vic2Mods, flagFiles); possiblePath)
 		{
 			return *possiblePath;
 		}
 	}
 
-	if (auto possiblePath = getAllowModFlags(Vic2Tag + sourceSuffix, vic2Mods);
-		 possiblePath && commonItems::DoesFileExist(*possiblePath))
+	if (auto possiblePath = getAllowModFlags(Vic2Tag + sourceSuffix, vic2Mods, flagFiles); possiblePath)
 	{
 		return *possiblePath;
 	}
 
 	if (isThisAConvertedTag(Vic2Tag))
 	{
-		if (auto possiblePath = getConversionModFlag(Vic2Tag + ".tga", vic2Mods);
-			 possiblePath && commonItems::DoesFileExist(*possiblePath))
+		if (auto possiblePath = getConversionModFlag(Vic2Tag + ".tga", vic2Mods, flagFiles); possiblePath)
 		{
 			return *possiblePath;
 		}
 	}
 
 	path = "flags/" + Vic2Tag + ".tga";
-	if (commonItems::DoesFileExist(path))
+	if (flagFiles.contains(getFlagFileKey(path)))
 	{
 		return path;
 	}
 
-	Log(LogLevel::Warning) << "Could not find source flag: " << Vic2Tag << sourceSuffix;
+	warnings.push_back("Could not find source flag: " + Vic2Tag + sourceSuffix);
 	return {};
 }
 
@@ -205,12 +428,14 @@ bool HoI4::isThisAConvertedTag(const std::string& Vic2Tag)
 }
 
 
-std::optional<std::string> HoI4::getConversionModFlag(const std::string& flagFilename, const Mods& vic2Mods)
+std::optional<std::string> HoI4::getConversionModFlag(const std::string& flagFilename,
+	 const Mods& vic2Mods,
+	 const std::unordered_set<std::string>& flagFiles)
 {
 	for (const auto& mod: vic2Mods)
 	{
 		const auto path = mod.path + "/gfx/flags/" + flagFilename;
-		if (commonItems::DoesFileExist(path))
+		if (flagFiles.contains(getFlagFileKey(path)))
 		{
 			return path;
 		}
@@ -220,7 +445,9 @@ std::optional<std::string> HoI4::getConversionModFlag(const std::string& flagFil
 }
 
 
-std::optional<std::string> HoI4::getAllowModFlags(const std::string& flagFilename, const Mods& vic2Mods)
+std::optional<std::string> HoI4::getAllowModFlags(const std::string& flagFilename,
+	 const Mods& vic2Mods,
+	 const std::unordered_set<std::string>& flagFiles)
 {
 	for (const auto& mod: vic2Mods)
 	{
@@ -229,7 +456,7 @@ std::optional<std::string> HoI4::getAllowModFlags(const std::string& flagFilenam
 			continue;
 		}
 		const auto path = mod.path + "/gfx/flags/" + flagFilename;
-		if (commonItems::DoesFileExist(path))
+		if (flagFiles.contains(getFlagFileKey(path)))
 		{
 			return path;
 		}
@@ -239,11 +466,11 @@ std::optional<std::string> HoI4::getAllowModFlags(const std::string& flagFilenam
 }
 
 
-std::optional<tga_image*> HoI4::createDominionFlag(const std::string& hoi4Suffix,
-	 const std::string& vic2Suffix,
-	 const std::string& overlord,
+std::shared_ptr<const tga_image> HoI4::createDominionFlag(const std::string& hoi4Suffix,
+	 const std::optional<std::string>& overlordFlagPath,
 	 const std::string& region,
-	 const Mods& vic2Mods)
+	 LoadedResources<tga_image>& decodedFlags,
+	 std::vector<std::string>& warnings)
 {
 	constexpr int sizeX = 93;
 	constexpr int sizeY = 64;
@@ -267,7 +494,7 @@ std::optional<tga_image*> HoI4::createDominionFlag(const std::string& hoi4Suffix
 	flag->image_data = static_cast<uint8_t*>(malloc(sizeX * sizeY * 4));
 	if (flag->image_data == nullptr)
 	{
-		return flag;
+		return shareFlag(flag);
 	}
 
 	const auto [r, g, b] = HoI4::getDominionFlagBaseColor(hoi4Suffix);
@@ -284,13 +511,13 @@ std::optional<tga_image*> HoI4::createDominionFlag(const std::string& hoi4Suffix
 		}
 	}
 
-	if (const auto ownerSourcePath = getSourceFlagPath(overlord, vic2Suffix, vic2Mods); ownerSourcePath)
+	if (overlordFlagPath)
 	{
-		if (const auto ownerSourceFlag = readFlag(*ownerSourcePath); ownerSourceFlag)
+		if (const auto ownerSourceFlag = readDecodedFlag(*overlordFlagPath, decodedFlags, warnings); ownerSourceFlag)
 		{
-			const auto sourceBytesPerPixel = (*ownerSourceFlag)->pixel_depth / 8;
-			const auto sourceHeight = (*ownerSourceFlag)->height;
-			const auto sourceWidth = (*ownerSourceFlag)->width;
+			const auto sourceBytesPerPixel = ownerSourceFlag->pixel_depth / 8;
+			const auto sourceHeight = ownerSourceFlag->height;
+			const auto sourceWidth = ownerSourceFlag->width;
 
 			const auto verticalStartLine = sizeY - ((sourceHeight + 1) / 2);
 			for (int y = 0; y < sourceHeight; y += 2)
@@ -300,42 +527,41 @@ std::optional<tga_image*> HoI4::createDominionFlag(const std::string& hoi4Suffix
 					const auto sourceIndex = (y * sourceWidth + x) * sourceBytesPerPixel;
 					const auto destIndex = ((y / 2 + verticalStartLine) * sizeX + (x / 2)) * 4;
 
-					flag->image_data[destIndex + 0] = (*ownerSourceFlag)->image_data[sourceIndex + 0];
-					flag->image_data[destIndex + 1] = (*ownerSourceFlag)->image_data[sourceIndex + 1];
-					flag->image_data[destIndex + 2] = (*ownerSourceFlag)->image_data[sourceIndex + 2];
+					flag->image_data[destIndex + 0] = ownerSourceFlag->image_data[sourceIndex + 0];
+					flag->image_data[destIndex + 1] = ownerSourceFlag->image_data[sourceIndex + 1];
+					flag->image_data[destIndex + 2] = ownerSourceFlag->image_data[sourceIndex + 2];
 					flag->image_data[destIndex + 3] = 0xFF;
 				}
 			}
 		}
 	}
 
-	const auto emblemPath = "flags/" + region + "_emblem.tga";
-	const auto emblem = readFlag(emblemPath);
+	const auto emblem = readDecodedFlag(getEmblemPath(region), decodedFlags, warnings);
 	if (emblem)
 	{
-		const auto sourceBytesPerPixel = (*emblem)->pixel_depth / 8;
-		for (unsigned int y = 0; y < (*emblem)->height; y++)
+		const auto sourceBytesPerPixel = emblem->pixel_depth / 8;
+		for (unsigned int y = 0; y < emblem->height; y++)
 		{
-			for (unsigned int x = 0; x < (*emblem)->width; x++)
+			for (unsigned int x = 0; x < emblem->width; x++)
 			{
-				const auto sourceIndex = (y * (*emblem)->width + x) * sourceBytesPerPixel;
-				const auto destIndex = (y * sizeX + (sizeX - (*emblem)->width) + x) * 4;
+				const auto sourceIndex = (y * emblem->width + x) * sourceBytesPerPixel;
+				const auto destIndex = (y * sizeX + (sizeX - emblem->width) + x) * 4;
 
 				// skip pixels masked by the alpha channel
-				if ((*emblem)->image_data[sourceIndex + 3] == 0)
+				if (emblem->image_data[sourceIndex + 3] == 0)
 				{
 					continue;
 				}
 
-				flag->image_data[destIndex + 0] = (*emblem)->image_data[sourceIndex + 0];
-				flag->image_data[destIndex + 1] = (*emblem)->image_data[sourceIndex + 1];
-				flag->image_data[destIndex + 2] = (*emblem)->image_data[sourceIndex + 2];
+				flag->image_data[destIndex + 0] = emblem->image_data[sourceIndex + 0];
+				flag->image_data[destIndex + 1] = emblem->image_data[sourceIndex + 1];
+				flag->image_data[destIndex + 2] = emblem->image_data[sourceIndex + 2];
 				flag->image_data[destIndex + 3] = 0xFF;
 			}
 		}
 	}
 
-	return flag;
+	return shareFlag(flag);
 }
 
 
@@ -366,10 +592,12 @@ std::tuple<uint8_t, uint8_t, uint8_t> HoI4::getDominionFlagBaseColor(std::string
 }
 
 
-std::optional<tga_image*> HoI4::createUnrecognizedNationFlag(const std::string& hoi4Suffix,
+std::shared_ptr<const tga_image> HoI4::createUnrecognizedNationFlag(const std::string& hoi4Suffix,
 	 const std::string& vic2Suffix,
 	 const std::string& region,
-	 const Mods& vic2Mods)
+	 const Mods& vic2Mods,
+	 LoadedResources<tga_image>& decodedFlags,
+	 std::vector<std::string>& warnings)
 {
 	constexpr int sizeX = 93;
 	constexpr int sizeY = 64;
@@ -393,7 +621,7 @@ std::optional<tga_image*> HoI4::createUnrecognizedNationFlag(const std::string&
 	flag->image_data = static_cast<uint8_t*>(malloc(sizeX * sizeY * 4));
 	if (flag->image_data == nullptr)
 	{
-		return flag;
+		return shareFlag(flag);
 	}
 
 	for (unsigned int y = 0; y < sizeY; y++)
@@ -409,45 +637,50 @@ std::optional<tga_image*> HoI4::createUnrecognizedNationFlag(const std::string&
 		}
 	}
 
-	const auto emblemPath = "flags/" + region + "_emblem.tga";
-	const auto emblem = readFlag(emblemPath);
+	const auto emblem = readDecodedFlag(getEmblemPath(region), decodedFlags, warnings);
 	if (emblem)
 	{
-		const auto sourceBytesPerPixel = (*emblem)->pixel_depth / 8;
-		for (unsigned int y = 0; y < (*emblem)->height; y++)
+		const auto sourceBytesPerPixel = emblem->pixel_depth / 8;
+		for (unsigned int y = 0; y < emblem->height; y++)
 		{
-			for (unsigned int x = 0; x < (*emblem)->width; x++)
+			for (unsigned int x = 0; x < emblem->width; x++)
 			{
-				const auto sourceIndex = (y * (*emblem)->width + x) * sourceBytesPerPixel;
-				const auto destX = sizeX / 2 - (*emblem)->width / 2 + x;
-				const auto destY = y + sizeY / 2 - (*emblem)->height / 2;
+				const auto sourceIndex = (y * emblem->width + x) * sourceBytesPerPixel;
+				const auto destX = sizeX / 2 - emblem->width / 2 + x;
+				const auto destY = y + sizeY / 2 - emblem->height / 2;
 				const auto destIndex = (destY * sizeX + destX) * 4;
 
 				// skip pixels masked by the alpha channel
-				if ((*emblem)->image_data[sourceIndex + 3] == 0)
+				if (emblem->image_data[sourceIndex + 3] == 0)
 				{
 					continue;
 				}
 
-				flag->image_data[destIndex + 0] = (*emblem)->image_data[sourceIndex + 0];
-				flag->image_data[destIndex + 1] = (*emblem)->image_data[sourceIndex + 1];
-				flag->image_data[destIndex + 2] = (*emblem)->image_data[sourceIndex + 2];
+				flag->image_data[destIndex + 0] = emblem->image_data[sourceIndex + 0];
+				flag->image_data[destIndex + 1] = emblem->image_data[sourceIndex + 1];
+				flag->image_data[destIndex + 2] = emblem->image_data[sourceIndex + 2];
 				flag->image_data[destIndex + 3] = 0xFF;
 			}
 		}
 	}
 
-	return flag;
+	return shareFlag(flag);
+}
+
+
+std::string HoI4::getEmblemPath(const std::string& region)
+{
+	return "flags/" + region + "_emblem.tga";
 }
 
 
-std::optional<tga_image*> HoI4::readFlag(const std::string& path)
+std::optional<tga_image*> HoI4::readFlag(const std::string& path, std::vector<std::string>& warnings)
 {
 	auto flag = new tga_image;
 	const auto result = tga_read(flag, path.c_str());
 	if (result != TGA_NOERR)
 	{
-		Log(LogLevel::Warning) << "Could not read flag " << path << ": " << tga_error(result) << ".";
+		warnings.push_back("Could not read flag " + path + ": " + tga_error(result) + ".");
 		delete flag;
 		return std::nullopt;
 	}
@@ -456,104 +689,122 @@ std::optional<tga_image*> HoI4::readFlag(const std::string& path)
 }
 
 
-tga_image* HoI4::createNewFlag(const tga_image* const sourceFlag, const unsigned int sizeX, const unsigned int sizeY)
+// a flag that couldn't be read isn't kept, so each flag that needs it warns about it
+std::shared_ptr<const tga_image> HoI4::readDecodedFlag(const std::string& path,
+	 LoadedResources<tga_image>& decodedFlags,
+	 std::vector<std::string>& warnings)
 {
-	const auto destFlag = new tga_image;
-	destFlag->image_id_length = 0;
-	destFlag->color_map_type = TGA_COLOR_MAP_ABSENT;
-	destFlag->image_type = TGA_IMAGE_TYPE_BGR;
-	destFlag->color_map_origin = 0;
-	destFlag->color_map_length = 0;
-	destFlag->color_map_depth = 0;
-	destFlag->origin_x = 0;
-	destFlag->origin_y = 0;
-	destFlag->width = sizeX;
-	destFlag->height = sizeY;
-	destFlag->pixel_depth = 32;
-	destFlag->image_descriptor = 8;
-	destFlag->image_id = nullptr;
-	destFlag->color_map_data = nullptr;
-
-	destFlag->image_data = static_cast<uint8_t*>(malloc(sizeX * sizeY * 4));
-	if (destFlag->image_data == nullptr)
-	{
-		return destFlag;
-	}
-	for (unsigned int y = 0; y < sizeY; y++)
-	{
-		for (unsigned int x = 0; x < sizeX; x++)
+	return decodedFlags.get(path, [&path, &warnings]() -> std::shared_ptr<const tga_image> {
+		const auto flag = readFlag(path, warnings);
+		if (!flag)
 		{
-			const auto sourceY = static_cast<int>(1.0 * y / sizeY * sourceFlag->height);
-			const auto sourceX = static_cast<int>(1.0 * x / sizeX * sourceFlag->width);
-			const auto sourceBytesPerPixel = sourceFlag->pixel_depth / 8;
-			const auto sourceIndex = (sourceY * sourceFlag->width + sourceX) * sourceBytesPerPixel;
-
-			const auto destIndex = (y * sizeX + x) * 4;
-
-			destFlag->image_data[destIndex + 0] = sourceFlag->image_data[sourceIndex + 0];
-			destFlag->image_data[destIndex + 1] = sourceFlag->image_data[sourceIndex + 1];
-			destFlag->image_data[destIndex + 2] = sourceFlag->image_data[sourceIndex + 2];
-			destFlag->image_data[destIndex + 3] = 0xFF;
+			return nullptr;
 		}
-	}
+		return shareFlag(*flag);
+	});
+}
+
 
-	return destFlag;
+std::shared_ptr<const tga_image> HoI4::shareFlag(tga_image* flag)
+{
+	return {flag, [](tga_image* sharedFlag) {
+				  tga_free_buffers(sharedFlag);
+				  delete sharedFlag;
+			  }};
 }
 
 
-void HoI4::createBigFlag(const tga_image* const sourceFlag, const std::string& filename, const std::string& outputName)
+void HoI4::createFlags(const tga_image* const sourceFlag,
+	 const std::string& filename,
+	 const std::string& outputName,
+	 std::vector<std::string>& warnings)
 {
-	const auto destFlag = createNewFlag(sourceFlag, 82, 52);
+	if (sourceFlag->pixel_depth != 24 && sourceFlag->pixel_depth != 32)
+	{
+		warnings.push_back("Could not resize flag " + filename + ": it is " + std::to_string(sourceFlag->pixel_depth) +
+								 " bit rather than 24 or 32 bit.");
+		return;
+	}
 
-	const tga_result result = tga_write(("output/" + outputName + "/gfx/flags/" + filename).c_str(), destFlag);
-	if (result)
+	auto images = resampleFlag(sourceFlag->image_data,
+		 sourceFlag->width,
+		 sourceFlag->height,
+		 sourceFlag->pixel_depth / 8,
+		 flagSizes);
+	for (size_t i = 0; i < flagSizes.size(); ++i)
 	{
-		tga_free_buffers(destFlag);
-		delete destFlag;
-		throw std::runtime_error(
-			 "Could not create output/" + outputName + "/gfx/flags/" + filename + " : " + tga_error(result));
+		writeFlag(images[i], flagSizes[i], "output/" + outputName + flagFolders[i] + filename);
 	}
+}
 
-	tga_free_buffers(destFlag);
-	delete destFlag;
+
+void HoI4::writeFlag(std::vector<uint8_t>& imageData, const FlagSize& size, const std::string& path)
+{
+	tga_image flag;
+	flag.image_id_length = 0;
+	flag.color_map_type = TGA_COLOR_MAP_ABSENT;
+	flag.image_type = TGA_IMAGE_TYPE_BGR;
+	flag.color_map_origin = 0;
+	flag.color_map_length = 0;
+	flag.color_map_depth = 0;
+	flag.origin_x = 0;
+	flag.origin_y = 0;
+	flag.width = static_cast<uint16_t>(size.width);
+	flag.height = static_cast<uint16_t>(size.height);
+	flag.pixel_depth = 32;
+	flag.image_descriptor = 8;
+	flag.image_id = nullptr;
+	flag.color_map_data = nullptr;
+	flag.image_data = imageData.data();
+
+	if (const auto result = tga_write(path.c_str(), &flag); result != TGA_NOERR)
+	{
+		throw std::runtime_error("Could not create " + path + " : " + tga_error(result));
+	}
 }
 
 
-void HoI4::createMediumFlag(const tga_image* const sourceFlag,
+bool HoI4::copyCachedFlags(FlagCache& flagCache,
+	 const std::string& cacheKey,
 	 const std::string& filename,
 	 const std::string& outputName)
 {
-	const auto destFlag = createNewFlag(sourceFlag, 41, 26);
+	// the flags are reused only if every size is cached, as making the rest would write through links into the cache
+	for (const auto& size: flagSizes)
+	{
+		if (!flagCache.hasFlag(getSizeCacheKey(cacheKey, size)))
+		{
+			return false;
+		}
+	}
 
-	const tga_result result = tga_write(("output/" + outputName + "/gfx/flags/medium/" + filename).c_str(), destFlag);
-	if (result)
+	for (size_t i = 0; i < flagSizes.size(); ++i)
 	{
-		tga_free_buffers(destFlag);
-		delete destFlag;
-		throw std::runtime_error(
-			 "Could not create output/" + outputName + "/gfx/flags/medium/" + filename + " : " + tga_error(result));
+		const auto path = "output/" + outputName + flagFolders[i] + filename;
+		if (!flagCache.copyFlag(getSizeCacheKey(cacheKey, flagSizes[i]), path))
+		{
+			throw std::runtime_error("Could not create " + path + " from the flag cache");
+		}
 	}
 
-	tga_free_buffers(destFlag);
-	delete destFlag;
+	return true;
 }
 
 
-void HoI4::createSmallFlag(const tga_image* const sourceFlag,
+void HoI4::storeFlagsInCache(FlagCache& flagCache,
+	 const std::string& cacheKey,
 	 const std::string& filename,
 	 const std::string& outputName)
 {
-	const auto destFlag = createNewFlag(sourceFlag, 10, 7);
-
-	const tga_result result = tga_write(("output/" + outputName + "/gfx/flags/small/" + filename).c_str(), destFlag);
-	if (result)
+	for (size_t i = 0; i < flagSizes.size(); ++i)
 	{
-		tga_free_buffers(destFlag);
-		delete destFlag;
-		throw std::runtime_error(
-			 "Could not create output/" + outputName + "/gfx/flags/small/" + filename + " : " + tga_error(result));
+		const auto path = "output/" + outputName + flagFolders[i] + filename;
+		flagCache.storeFlag(getSizeCacheKey(cacheKey, flagSizes[i]), path);
 	}
+}
 
-	tga_free_buffers(destFlag);
-	delete destFlag;
-}
\ No newline at end of file
+
+std::string HoI4::getSizeCacheKey(const std::string& cacheKey, const FlagSize& size)
+{
+	return cacheKey + "_" + std::to_string(size.width) + "x" + std::to_string(size.height);
+}
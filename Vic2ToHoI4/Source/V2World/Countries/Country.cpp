@@ -9,6 +9,26 @@
 
 
 
+void Vic2::Country::addProvince(const int provinceNum, const std::shared_ptr<Province>& province)
+{
+	if (provinces.insert(std::make_pair(provinceNum, province)).second)
+	{
+		addIssueSupport(*province);
+	}
+}
+
+
+void Vic2::Country::addIssueSupport(const Province& province)
+{
+	const auto& pops = province.getPops();
+	population_ += pops.getPopulation();
+	for (const auto& [issue, weightedSupport]: pops.getIssueTotals())
+	{
+		issueSupport_[issue] += weightedSupport;
+	}
+}
+
+
 void Vic2::Country::eatCountry(Country& target, bool debug)
 {
 	if (target.tag == tag)
@@ -30,7 +50,7 @@ void Vic2::Country::eatCountry(Country& target, bool debug)
 	for (auto& provinceItr: target.provinces)
 	{
 		provinceItr.second->setOwner(tag);
-		provinces.insert(provinceItr);
+		addProvince(provinceItr.first, provinceItr.second);
 	}
 	technologiesAndInventions.insert(target.technologiesAndInventions.begin(), target.technologiesAndInventions.end());
 	armies.insert(armies.end(), target.armies.begin(), target.armies.end());
@@ -229,24 +249,23 @@ int32_t Vic2::Country::getEmployedWorkers() const
 
 float Vic2::Country::getAverageIssueSupport(const std::string& issueName) const
 {
-	float totalPopulation = 0.0;
-	float totalSupport = 0.0;
-	for (const auto& province: provinces | std::views::values)
+	if (population_ == 0)
 	{
-		for (const auto& pop: province->getPops())
-		{
-			const auto size = static_cast<float>(pop.getSize());
-			totalSupport += pop.getIssueSupport(issueName) * size;
-			totalPopulation += size;
-		}
+		return 0.0F;
 	}
 
-	if (totalPopulation == 0.0F)
+	const auto issue = findPopName(issueName);
+	if (!issue)
+	{
+		return 0.0F;
+	}
+	const auto support = issueSupport_.find(*issue);
+	if (support == issueSupport_.end())
 	{
 		return 0.0F;
 	}
 
-	return totalSupport / totalPopulation;
+	return static_cast<float>(support->second / population_);
 }
 
 
@@ -24,6 +24,7 @@
 #include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 
@@ -38,10 +39,7 @@ class Country
 	class Factory;
 
 	// functions to construct the country
-	void addProvince(int provinceNum, const std::shared_ptr<Province>& province)
-	{
-		provinces.insert(std::make_pair(provinceNum, province));
-	}
+	void addProvince(int provinceNum, const std::shared_ptr<Province>& province);
 	void addCore(std::shared_ptr<Province> core) { cores.push_back(std::move(core)); }
 	void replaceCores(std::vector<std::shared_ptr<Province>> newCores) { cores.swap(newCores); }
 	void addWar(const War& theWar) { wars.push_back(theWar); }
@@ -107,6 +105,7 @@ class Country
 	[[nodiscard]] std::vector<std::string> getShipNames(const std::string& category) const;
 
   private:
+	void addIssueSupport(const Province& province);
 	std::map<std::string, int> determineCultureSizes();
 	static std::string selectLargestCulture(const std::map<std::string, int>& cultureSizes);
 
@@ -120,6 +119,8 @@ class Country
 	std::vector<State> states;
 	std::map<int, std::shared_ptr<Province>> provinces;
 	std::vector<std::shared_ptr<Province>> cores;
+	int population_ = 0;
+	std::unordered_map<uint32_t, double> issueSupport_; // support * size summed over the country's pops, by issue
 	int capital = 0;
 
 	std::string primaryCulture = "no_culture";
@@ -91,7 +91,7 @@ class Country::Builder
 
 	Builder& addProvince(int provinceNum, std::shared_ptr<Province> province)
 	{
-		country->provinces.insert(std::make_pair(provinceNum, province));
+		country->addProvince(provinceNum, std::move(province));
 		return *this;
 	}
 
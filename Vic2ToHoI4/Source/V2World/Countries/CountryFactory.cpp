@@ -1,183 +1,241 @@
 #include "CountryFactory.h"
-#include "CommonRegexes.h"
-#include "Log.h"
-#include "ParserHelpers.h"
-#include "StringUtils.h"
 #include "V2World/Culture/CultureGroupsFactory.h"
 #include "V2World/Military/Leaders/TraitsFactory.h"
+#include "V2World/Save/SaveKeys.h"
 #include "V2World/Technology/InventionsFactory.h"
 #include <cmath>
-#include <sstream>
 
 
 
 Vic2::Country::Factory::Factory(const Configuration& theConfiguration,
 	 const StateDefinitions& theStateDefinitions,
 	 std::shared_ptr<CultureGroups> theCultureGroups_):
-	 theCultureGroups(std::move(theCultureGroups_)),
-	 theInventions(Inventions::Factory().loadInventions(theConfiguration)),
-	 leaderFactory(
-		  std::make_unique<Leader::Factory>(std::move(*Traits::Factory().loadTraits(theConfiguration.getVic2Path())))),
+	 Factory(Inventions::Factory::loadSharedInventions(theConfiguration),
+		  std::move(*Traits::Factory().loadTraits(theConfiguration.getVic2Path())),
+		  theStateDefinitions,
+		  std::move(theCultureGroups_))
+{
+}
+
+
+Vic2::Country::Factory::Factory(std::shared_ptr<const Inventions> theInventions_,
+	 Traits theTraits,
+	 const StateDefinitions& theStateDefinitions,
+	 std::shared_ptr<CultureGroups> theCultureGroups_):
+	 theStateDefinitions(theStateDefinitions),
+	 theCultureGroups(std::move(theCultureGroups_)), theInventions(std::move(theInventions_)),
+	 leaderFactory(std::make_unique<Leader::Factory>(std::move(theTraits))),
 	 stateFactory(std::make_unique<State::Factory>())
 {
-	registerKeyword("capital", [this](std::istream& theStream) {
-		country->capital = commonItems::singleInt{theStream}.getInt();
+}
+
+
+std::unique_ptr<Vic2::Country> Vic2::Country::Factory::createCountry(const std::string& theTag,
+	 SaveTokenizer& tokenizer,
+	 const CommonCountryData& commonCountryData,
+	 const std::vector<Party>& allParties,
+	 const StateLanguageCategories& stateLanguageCategories,
+	 float percentOfCommanders,
+	 const std::optional<CountryData>& countryData,
+	 std::vector<std::string>& warnings)
+{
+	country = std::make_unique<Country>();
+	country->tag = theTag;
+	country->color = commonCountryData.getColor();
+	country->shipNames = commonCountryData.getUnitNames();
+
+	rulingPartyID = 0; // Bad value, but normal for Rebel faction.
+	tokenizer.parseBlock([this, &tokenizer, &warnings](const std::string_view key) {
+		importItem(key, tokenizer, warnings);
 	});
-	registerKeyword("civilized", [this](std::istream& theStream) {
-		if (commonItems::singleString{theStream}.getString() == "yes")
+	setParties(allParties, warnings);
+	limitCommanders(percentOfCommanders);
+	setStateLanguageCategories(stateLanguageCategories, warnings);
+	if (countryData)
+	{
+		country->lastDynasty = countryData->getLastDynasty();
+		country->lastMonarch = countryData->getLastMonarch();
+	}
+
+	return std::move(country);
+}
+
+
+// Only the items the converter keeps are copied out of the save. The nested blocks are handed to their own factories.
+void Vic2::Country::Factory::importItem(const std::string_view key,
+	 SaveTokenizer& tokenizer,
+	 std::vector<std::string>& warnings)
+{
+	if (key == "capital")
+	{
+		country->capital = tokenizer.getInt();
+	}
+	else if (key == "civilized")
+	{
+		if (tokenizer.getString() == "yes")
 		{
 			country->civilized = true;
 		}
-	});
-	registerKeyword("revanchism", [this](std::istream& theStream) {
-		country->revanchism = commonItems::singleDouble{theStream}.getDouble();
-	});
-	registerKeyword("war_exhaustion", [this](std::istream& theStream) {
-		country->warExhaustion = commonItems::singleDouble{theStream}.getDouble();
-	});
-	registerKeyword("badboy", [this](std::istream& theStream) {
-		country->badBoy = commonItems::singleDouble{theStream}.getDouble();
-	});
-	registerKeyword("government", [this](std::istream& theStream) {
-		country->government = commonItems::singleString{theStream}.getString();
-	});
-	registerKeyword("last_election", [this](std::istream& theStream) {
-		country->lastElection = date(commonItems::singleString{theStream}.getString());
-	});
-	registerKeyword("domain_region", [this](std::istream& theStream) {
-		country->domainName = commonItems::singleString{theStream}.getString();
+	}
+	else if (key == "revanchism")
+	{
+		country->revanchism = tokenizer.getDouble();
+	}
+	else if (key == "war_exhaustion")
+	{
+		country->warExhaustion = tokenizer.getDouble();
+	}
+	else if (key == "badboy")
+	{
+		country->badBoy = tokenizer.getDouble();
+	}
+	else if (key == "government")
+	{
+		country->government = tokenizer.getString();
+	}
+	else if (key == "last_election")
+	{
+		country->lastElection = date(std::string(tokenizer.getString()));
+	}
+	else if (key == "domain_region")
+	{
+		country->domainName = tokenizer.getString();
 		country->domainAdjective = country->domainName;
-	});
-	registerKeyword("human", [this](std::istream& theStream) {
-		if (commonItems::singleString{theStream}.getString() == "yes")
+	}
+	else if (key == "human")
+	{
+		if (tokenizer.getString() == "yes")
 		{
 			country->human = true;
 		}
-	});
-	registerKeyword("primary_culture", [this](std::istream& theStream) {
-		country->primaryCulture = commonItems::remQuotes(commonItems::singleString{theStream}.getString());
-		country->acceptedCultures.insert(country->primaryCulture);
-
-		auto cultureGroupOption = theCultureGroups->getGroup(country->primaryCulture);
-		if (cultureGroupOption)
-		{
-			country->primaryCultureGroup = *cultureGroupOption;
-		}
-		else
-		{
-			country->primaryCultureGroup.clear();
-		}
-	});
-	registerKeyword("culture", [this](std::istream& theStream) {
-		for (const auto& culture: commonItems::stringList{theStream}.getStrings())
+	}
+	else if (key == "primary_culture")
+	{
+		setPrimaryCulture(std::string(tokenizer.getString()));
+	}
+	else if (key == "culture")
+	{
+		for (const auto& culture: tokenizer.getStrings())
 		{
-			country->acceptedCultures.insert(commonItems::remQuotes(culture));
+			country->acceptedCultures.insert(std::string(culture));
 		}
-	});
-	registerKeyword("technology", [this](std::istream& theStream) {
-		for (const auto& technology: technologyFactory.importTechnologies(theStream))
+	}
+	else if (key == "technology")
+	{
+		auto technologyStream = makeItemStream(tokenizer.getItem());
+		for (const auto& technology: technologyFactory.importTechnologies(technologyStream))
 		{
 			country->technologiesAndInventions.insert(technology);
 		}
-	});
-	registerKeyword("active_inventions", [this](std::istream& theStream) {
-		for (auto inventionNum: commonItems::intList{theStream}.getInts())
+	}
+	else if (key == "active_inventions")
+	{
+		for (auto inventionNum: tokenizer.getInts())
 		{
 			if (auto inventionName = theInventions->getInventionName(inventionNum); inventionName)
 			{
 				country->technologiesAndInventions.insert(*inventionName);
 			}
 		}
-	});
-	registerKeyword("active_party", [this](std::istream& theStream) {
-		const auto partyNum = commonItems::singleInt(theStream).getInt();
+	}
+	else if (key == "active_party")
+	{
+		const auto partyNum = tokenizer.getInt();
 		country->activePartyIDs.push_back(partyNum);
 		if (rulingPartyID == 0)
 		{
 			rulingPartyID = partyNum;
 		}
-	});
-	registerKeyword("ruling_party", [this](std::istream& theStream) {
-		rulingPartyID = commonItems::singleInt{theStream}.getInt();
-	});
-	registerKeyword("upper_house", [this](std::istream& theStream) {
-		for (const auto& [ideology, amountString]: commonItems::assignments{theStream}.getAssignments())
-		{
+	}
+	else if (key == "ruling_party")
+	{
+		rulingPartyID = tokenizer.getInt();
+	}
+	else if (key == "upper_house")
+	{
+		tokenizer.parseAssignments([this, &warnings](const std::string_view ideology,
+												 const std::string_view amountString) {
 			try
 			{
-				country->upperHouseComposition.insert(make_pair(ideology, stof(amountString)));
+				country->upperHouseComposition.insert(make_pair(std::string(ideology), stof(std::string(amountString))));
 			}
 			catch (...)
 			{
-				Log(LogLevel::Warning) << "Malformed input while importing upper house composition for " << country->tag;
+				warnings.push_back("Malformed input while importing upper house composition for " + country->tag);
 			}
-		}
-	});
-	registerRegex("[A-Z][A-Z0-9]{2}", [this](const std::string& countryTag, std::istream& theStream) {
-		country->relations.insert(std::make_pair(countryTag, *relationsFactory.getRelations(theStream)));
-	});
-	registerKeyword("ai", [this](std::istream& theStream) {
-		country->vic2AI = *aiFactory.importAI(theStream);
-	});
-	registerKeyword("army", [this](std::istream& theStream) {
-		country->armies.push_back(*armyFactory.getArmy(country->tag, theStream));
-	});
-	registerKeyword("navy", [this](std::istream& theStream) {
-		const auto navy = armyFactory.getArmy(country->tag, theStream);
+		});
+	}
+	else if (key == "ai")
+	{
+		auto aiStream = makeItemStream(tokenizer.getItem());
+		country->vic2AI = *aiFactory.importAI(aiStream);
+	}
+	else if (key == "army")
+	{
+		auto armyStream = makeItemStream(tokenizer.getItem());
+		country->armies.push_back(*armyFactory.getArmy(country->tag, armyStream, warnings));
+	}
+	else if (key == "navy")
+	{
+		auto navyStream = makeItemStream(tokenizer.getItem());
+		const auto navy = armyFactory.getArmy(country->tag, navyStream, warnings);
 		for (auto& transportedArmy: navy->getTransportedArmies())
 		{
 			country->armies.push_back(transportedArmy);
 		}
 		country->armies.push_back(*navy);
-	});
-	registerKeyword("leader", [this](std::istream& theStream) {
-		country->leaders.push_back(*leaderFactory->getLeader(theStream));
-	});
-	registerKeyword("state", [this, &theStateDefinitions](std::istream& theStream) {
-		country->states.push_back(*stateFactory->getState(theStream, country->tag, theStateDefinitions));
-	});
-	registerKeyword("flags", [this](std::istream& theStream) {
-		for (const auto& [flag, unused]: commonItems::assignments{theStream}.getAssignments())
-		{
-			country->flags.insert(flag);
-		}
-	});
-	registerKeyword("stockpile", [this](std::istream& theStream) {
-		country->stockpile = stockpileFactory.importStockpile(theStream);
-	});
-	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
+	}
+	else if (key == "leader")
+	{
+		auto leaderStream = makeItemStream(tokenizer.getItem());
+		country->leaders.push_back(*leaderFactory->getLeader(leaderStream));
+	}
+	else if (key == "state")
+	{
+		auto stateStream = makeItemStream(tokenizer.getItem());
+		country->states.push_back(*stateFactory->getState(stateStream, country->tag, theStateDefinitions, warnings));
+	}
+	else if (key == "flags")
+	{
+		tokenizer.parseAssignments([this](const std::string_view flag, std::string_view) {
+			country->flags.insert(std::string(flag));
+		});
+	}
+	else if (key == "stockpile")
+	{
+		auto stockpileStream = makeItemStream(tokenizer.getItem());
+		country->stockpile = stockpileFactory.importStockpile(stockpileStream);
+	}
+	else if (isCountryTag(key))
+	{
+		auto relationsStream = makeItemStream(tokenizer.getItem());
+		country->relations.insert(std::make_pair(std::string(key), *relationsFactory.getRelations(relationsStream)));
+	}
+	else
+	{
+		tokenizer.skipItem();
+	}
 }
 
 
-std::unique_ptr<Vic2::Country> Vic2::Country::Factory::createCountry(const std::string& theTag,
-	 std::istream& theStream,
-	 const CommonCountryData& commonCountryData,
-	 const std::vector<Party>& allParties,
-	 const StateLanguageCategories& stateLanguageCategories,
-	 float percentOfCommanders,
-	 const std::optional<CountryData>& countryData)
+void Vic2::Country::Factory::setPrimaryCulture(const std::string& primaryCulture)
 {
-	country = std::make_unique<Country>();
-	country->tag = theTag;
-	country->color = commonCountryData.getColor();
-	country->shipNames = commonCountryData.getUnitNames();
+	country->primaryCulture = primaryCulture;
+	country->acceptedCultures.insert(country->primaryCulture);
 
-	rulingPartyID = 0; // Bad value, but normal for Rebel faction.
-	parseStream(theStream);
-	setParties(allParties);
-	limitCommanders(percentOfCommanders);
-	setStateLanguageCategories(stateLanguageCategories);
-	if (countryData)
+	auto cultureGroupOption = theCultureGroups->getGroup(country->primaryCulture);
+	if (cultureGroupOption)
 	{
-		country->lastDynasty = countryData->getLastDynasty();
-		country->lastMonarch = countryData->getLastMonarch();
+		country->primaryCultureGroup = *cultureGroupOption;
+	}
+	else
+	{
+		country->primaryCultureGroup.clear();
 	}
-
-	return std::move(country);
 }
 
 
-void Vic2::Country::Factory::setParties(const std::vector<Party>& allParties)
+void Vic2::Country::Factory::setParties(const std::vector<Party>& allParties, std::vector<std::string>& warnings)
 {
 	if (country->tag == "REB")
 	{
@@ -191,13 +249,13 @@ void Vic2::Country::Factory::setParties(const std::vector<Party>& allParties)
 		}
 		else
 		{
-			Log(LogLevel::Warning) << "Party ID mismatch! Did some Vic2 country files not get read?";
+			warnings.push_back("Party ID mismatch! Did some Vic2 country files not get read?");
 		}
 	}
 
 	if (rulingPartyID == 0)
 	{
-		LOG(LogLevel::Warning) << country->tag << " had no ruling party. The save may need manual repair.";
+		warnings.push_back(country->tag + " had no ruling party. The save may need manual repair.");
 	}
 	else if (rulingPartyID > allParties.size())
 	{
@@ -246,7 +304,8 @@ void Vic2::Country::Factory::limitCommanders(float percentOfCommanders)
 }
 
 
-void Vic2::Country::Factory::setStateLanguageCategories(const StateLanguageCategories& stateLanguageCategories)
+void Vic2::Country::Factory::setStateLanguageCategories(const StateLanguageCategories& stateLanguageCategories,
+	 std::vector<std::string>& warnings)
 {
 	for (auto& state: country->states)
 	{
@@ -257,7 +316,7 @@ void Vic2::Country::Factory::setStateLanguageCategories(const StateLanguageCateg
 		}
 		else
 		{
-			Log(LogLevel::Warning) << state.getStateID() << " was not in any language category.";
+			warnings.push_back(state.getStateID() + " was not in any language category.");
 		}
 	}
 }
\ No newline at end of file
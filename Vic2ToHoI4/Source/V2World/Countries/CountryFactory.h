@@ -6,13 +6,14 @@
 #include "CommonCountryData.h"
 #include "Configuration.h"
 #include "Country.h"
-#include "Parser.h"
 #include "V2World/Ai/AIFactory.h"
 #include "V2World/Culture/CultureGroups.h"
 #include "V2World/Diplomacy/RelationsFactory.h"
 #include "V2World/EU4ToVic2Data/CountryData.h"
 #include "V2World/Military/ArmyFactory.h"
 #include "V2World/Military/Leaders/LeaderFactory.h"
+#include "V2World/Military/Leaders/Traits.h"
+#include "V2World/Save/SaveTokenizer.h"
 #include "V2World/States/StateFactory.h"
 #include "V2World/States/StateLanguageCategories.h"
 #include "V2World/Stockpiles/StockpileFactory.h"
@@ -20,33 +21,46 @@
 #include "V2World/Technology/TechnologyFactory.h"
 #include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 
 
 namespace Vic2
 {
 
-class Country::Factory: commonItems::parser
+class Country::Factory
 {
   public:
 	Factory(const Configuration& theConfiguration,
 		 const StateDefinitions& theStateDefinitions,
 		 std::shared_ptr<CultureGroups> theCultureGroups_);
+	// for factories that share game data, such as one per thread while reading a save
+	Factory(std::shared_ptr<const Inventions> theInventions_,
+		 Traits theTraits,
+		 const StateDefinitions& theStateDefinitions,
+		 std::shared_ptr<CultureGroups> theCultureGroups_);
 	std::unique_ptr<Country> createCountry(const std::string& theTag,
-		 std::istream& theStream,
+		 SaveTokenizer& tokenizer,
 		 const CommonCountryData& commonCountryData,
 		 const std::vector<Party>& allParties,
 		 const StateLanguageCategories& stateLanguageCategories,
 		 float percentOfCommanders,
-		 const std::optional<CountryData>& countryData);
+		 const std::optional<CountryData>& countryData,
+		 std::vector<std::string>& warnings);
 
   private:
-	void setParties(const std::vector<Party>& allParties);
+	void importItem(std::string_view key, SaveTokenizer& tokenizer, std::vector<std::string>& warnings);
+	void setPrimaryCulture(const std::string& primaryCulture);
+	void setParties(const std::vector<Party>& allParties, std::vector<std::string>& warnings);
 	void limitCommanders(float percentOfCommanders);
-	void setStateLanguageCategories(const StateLanguageCategories& stateLanguageCategories);
+	void setStateLanguageCategories(const StateLanguageCategories& stateLanguageCategories,
+		 std::vector<std::string>& warnings);
 
+	const StateDefinitions& theStateDefinitions;
 	std::shared_ptr<CultureGroups> theCultureGroups;
-	std::unique_ptr<Inventions> theInventions;
+	std::shared_ptr<const Inventions> theInventions;
 	Relations::Factory relationsFactory;
 	Army::Factory armyFactory;
 	std::unique_ptr<Leader::Factory> leaderFactory;
@@ -2,8 +2,11 @@
 #include "Configuration.h"
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
-#include <array>
+#include <algorithm>
 #include <fstream>
+#include <future>
+#include <iterator>
+#include <thread>
 
 
 
@@ -12,111 +15,73 @@ std::unique_ptr<Vic2::Localisations> Vic2::Localisations::Factory::importLocalis
 {
 	Log(LogLevel::Info) << "Reading Vic2 localisation";
 
-	ReadFromAllFilesInFolder(theConfiguration.getVic2Path() + "/localisation");
+	std::vector<std::string> fileNames;
+	addFilesInFolder(theConfiguration.getVic2Path() + "/localisation", fileNames);
 
 	for (const auto& mod: theConfiguration.getVic2Mods())
 	{
 		Log(LogLevel::Info) << "\tReading mod localisation";
-		ReadFromAllFilesInFolder(mod.path + "/localisation");
+		addFilesInFolder(mod.path + "/localisation", fileNames);
 	}
 
-	ReadFromAllFilesInFolder("Configurables/Vic2Localisations");
+	addFilesInFolder("Configurables/Vic2Localisations", fileNames);
 
-	return std::make_unique<Localisations>(localisations, localisationToKeyMap);
+	// worker N reads every Nth file, and the files are handed over in the order above so later files still win
+	std::vector<LocalisationFile> files(fileNames.size());
+	const auto numWorkers = std::min(static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1U)),
+		 std::max(fileNames.size(), static_cast<size_t>(1)));
+	std::vector<std::future<void>> workers;
+	for (size_t worker = 0; worker < numWorkers; ++worker)
+	{
+		workers.push_back(std::async(std::launch::async, [&fileNames, &files, worker, numWorkers] {
+			for (auto i = worker; i < fileNames.size(); i += numWorkers)
+			{
+				files[i] = readFile(fileNames[i]);
+			}
+		}));
+	}
+	for (auto& worker: workers)
+	{
+		worker.get();
+	}
+
+	return std::make_unique<Localisations>(std::move(files));
 }
 
 
-void Vic2::Localisations::Factory::ReadFromAllFilesInFolder(const std::string& folderPath)
+void Vic2::Localisations::Factory::addFilesInFolder(const std::string& folderPath,
+	 std::vector<std::string>& fileNames)
 {
 	for (const auto& fileName: commonItems::GetAllFilesInFolder(folderPath))
 	{
-		ReadFromFile(folderPath + '/' + fileName);
+		fileNames.push_back(folderPath + '/' + fileName);
 	}
 }
 
 
-void Vic2::Localisations::Factory::ReadFromFile(const std::string& fileName)
+Vic2::LocalisationFile Vic2::Localisations::Factory::readFile(const std::string& fileName)
 {
 	std::ifstream in(fileName);
+	auto text =
+		 std::make_unique<const std::string>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
 
-	while (!in.eof())
+	LocalisationFile file;
+	std::string_view rest = *text;
+	while (true)
 	{
-		std::string line;
-		getline(in, line);
-		if (line[0] != '#')
+		const auto lineEnd = rest.find('\n');
+		const auto line = rest.substr(0, lineEnd);
+		if (!line.starts_with('#'))
 		{
-			processLine(line);
+			file.lines.push_back(line);
 		}
-	}
-
-	in.close();
-}
-
-
-constexpr std::array<std::pair<const char*, Vic2::Encoding>, 13> languages = {{
-	 {"english", Vic2::Encoding::Win1252},
-	 {"french", Vic2::Encoding::Win1252},
-	 {"german", Vic2::Encoding::Win1252},
-	 {"polish", Vic2::Encoding::Win1250},
-	 {"spanish", Vic2::Encoding::Win1252},
-	 {"italian", Vic2::Encoding::Win1252},
-	 {"swedish", Vic2::Encoding::Win1250},
-	 {"czech", Vic2::Encoding::Win1250},
-	 {"hungarian", Vic2::Encoding::Win1250},
-	 {"dutch", Vic2::Encoding::Win1252},
-	 {"braz_por", Vic2::Encoding::Win1252},
-	 {"russian", Vic2::Encoding::Win1251},
-	 {"finnish", Vic2::Encoding::Win1252},
-}};
-void Vic2::Localisations::Factory::processLine(const std::string& line)
-{
-	auto division = line.find_first_of(';');
-	const auto key = line.substr(0, division);
-
-	for (const auto& [language, encoding]: languages)
-	{
-		auto [rawLocalisation, newDivision] = extractNextLocalisation(line, division);
-		division = newDivision;
-
-		auto UTF8Result = convertToUtf8(rawLocalisation, encoding);
-
-		if (strcmp(language, "english") == 0)
+		if (lineEnd == std::string_view::npos)
 		{
-			localisationToKeyMap[UTF8Result] = key;
-		}
-
-		if (!UTF8Result.empty())
-		{
-			localisations[key][language] = UTF8Result;
-		}
-		else if (strcmp(language, "english") != 0)
-		{
-			localisations[key][language] = localisations[key]["english"];
+			break;
 		}
+		rest.remove_prefix(lineEnd + 1);
 	}
-}
-
+	file.text = std::move(text);
 
-std::tuple<std::string, size_t> Vic2::Localisations::Factory::extractNextLocalisation(const std::string& line,
-	 size_t division)
-{
-	const auto frontDivision = division + 1;
-	division = line.find_first_of(';', frontDivision);
-	return {line.substr(frontDivision, division - frontDivision), division};
+	return file;
 }
-
-
-std::string Vic2::Localisations::Factory::convertToUtf8(const std::string& rawLocalisation, Encoding encoding)
-{
-	if (encoding == Encoding::Win1250)
-	{
-		return commonItems::convertWin1250ToUTF8(rawLocalisation);
-	}
-	if (encoding == Encoding::Win1251)
-	{
-		return commonItems::convertWin1251ToUTF8(rawLocalisation);
-	}
-
-	// if (encoding == Encoding::Win1252)
-	return commonItems::convertWin1252ToUTF8(rawLocalisation);
-}
\ No newline at end of file
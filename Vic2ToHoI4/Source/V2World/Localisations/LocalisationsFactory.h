@@ -5,34 +5,22 @@
 
 #include "Configuration.h"
 #include "Vic2Localisations.h"
+#include <string>
+#include <vector>
 
 
 
 namespace Vic2
 {
 
-enum class Encoding
-{
-	Win1250,
-	Win1251,
-	Win1252,
-};
-
-
 class Localisations::Factory
 {
   public:
 	std::unique_ptr<Localisations> importLocalisations(const Configuration& theConfiguration);
 
   private:
-	void ReadFromAllFilesInFolder(const std::string& folderPath);
-	void ReadFromFile(const std::string& fileName);
-	void processLine(const std::string& line);
-	static std::tuple<std::string, size_t> extractNextLocalisation(const std::string& line, size_t division);
-	static std::string convertToUtf8(const std::string& rawLocalisation, Encoding encoding);
-
-	KeyToLocalisationsMap localisations;
-	std::map<std::string, std::string> localisationToKeyMap;
+	static void addFilesInFolder(const std::string& folderPath, std::vector<std::string>& fileNames);
+	static LocalisationFile readFile(const std::string& fileName);
 };
 
 } // namespace Vic2
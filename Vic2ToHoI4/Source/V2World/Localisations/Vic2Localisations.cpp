@@ -1,20 +1,90 @@
 #include "Vic2Localisations.h"
 #include "Log.h"
+#include "V2World/Localisations/Win125xConverter.h"
+#include <array>
+#include <cstring>
 #include <regex>
 
 
 
+namespace
+{
+
+constexpr std::array<std::pair<const char*, Vic2::Encoding>, 13> languages = {{
+	 {"english", Vic2::Encoding::Win1252},
+	 {"french", Vic2::Encoding::Win1252},
+	 {"german", Vic2::Encoding::Win1252},
+	 {"polish", Vic2::Encoding::Win1250},
+	 {"spanish", Vic2::Encoding::Win1252},
+	 {"italian", Vic2::Encoding::Win1252},
+	 {"swedish", Vic2::Encoding::Win1250},
+	 {"czech", Vic2::Encoding::Win1250},
+	 {"hungarian", Vic2::Encoding::Win1250},
+	 {"dutch", Vic2::Encoding::Win1252},
+	 {"braz_por", Vic2::Encoding::Win1252},
+	 {"russian", Vic2::Encoding::Win1251},
+	 {"finnish", Vic2::Encoding::Win1252},
+}};
+
+
+std::string_view extractKey(const std::string_view line)
+{
+	return line.substr(0, line.find_first_of(';'));
+}
+
+
+std::string_view extractNextLocalisation(const std::string_view line, size_t& division)
+{
+	const auto frontDivision = division + 1;
+	division = line.find_first_of(';', frontDivision);
+	return line.substr(frontDivision, division - frontDivision);
+}
+
+
+void addLineToLocalisations(const std::string_view line, Vic2::LanguageToLocalisationMap& localisations)
+{
+	auto division = line.find_first_of(';');
+	for (const auto& [language, encoding]: languages)
+	{
+		auto UTF8Result = Vic2::convertWin125xToUtf8(extractNextLocalisation(line, division), encoding);
+		if (!UTF8Result.empty())
+		{
+			localisations[language] = std::move(UTF8Result);
+		}
+		else if (strcmp(language, "english") != 0)
+		{
+			localisations[language] = localisations["english"];
+		}
+	}
+}
+
+} // namespace
+
+
+
+Vic2::Localisations::Localisations(std::vector<LocalisationFile> _files): files(std::move(_files))
+{
+	for (const auto& file: files)
+	{
+		for (const auto& line: file.lines)
+		{
+			unconvertedLines[extractKey(line)].push_back(line);
+		}
+	}
+}
+
+
 std::optional<std::string> Vic2::Localisations::getTextInLanguage(const std::string& key,
 	 const std::string& language) const
 {
-	const auto KeyToLocalisationsMapping = localisations.find(key);
-	if (KeyToLocalisationsMapping == localisations.end())
+	const auto* languageToLocalisations = findLocalisations(key);
+	if (languageToLocalisations == nullptr)
 	{
 		return std::nullopt;
 	}
 
-	const auto LanguageToLocalisationMapping = KeyToLocalisationsMapping->second.find(language);
-	if (LanguageToLocalisationMapping == KeyToLocalisationsMapping->second.end())
+	const auto LanguageToLocalisationMapping = languageToLocalisations->find(language);
+	if (LanguageToLocalisationMapping == languageToLocalisations->end())
 	{
 		return std::nullopt;
 	}
@@ -25,19 +95,41 @@ std::optional<std::string> Vic2::Localisations::getTextInLanguage(const std::str
 
 Vic2::LanguageToLocalisationMap Vic2::Localisations::getTextInEachLanguage(const std::string& key) const
 {
-	const auto KeyToLocalisationsMappings = localisations.find(key);
-	if (KeyToLocalisationsMappings == localisations.end())
+	const auto* languageToLocalisations = findLocalisations(key);
+	if (languageToLocalisations == nullptr)
 	{
 		return LanguageToLocalisationMap{};
 	}
 
-	return KeyToLocalisationsMappings->second;
+	return *languageToLocalisations;
+}
+
+
+const Vic2::LanguageToLocalisationMap* Vic2::Localisations::findLocalisations(const std::string& key) const
+{
+	std::scoped_lock lock(conversionMutex);
+	if (const auto converted = localisations.find(key); converted != localisations.end())
+	{
+		return &converted->second;
+	}
+
+	const auto lines = unconvertedLines.find(key);
+	if (lines == unconvertedLines.end())
+	{
+		return nullptr;
+	}
+	auto& languageToLocalisations = localisations[key];
+	for (const auto& line: lines->second)
+	{
+		addLineToLocalisations(line, languageToLocalisations);
+	}
+	return &languageToLocalisations;
 }
 
 
 void Vic2::Localisations::updateDomainCountry(const std::string& tag, const std::string& domainName)
 {
-	if (!localisations.contains(tag))
+	if (findLocalisations(tag) == nullptr)
 	{
 		return;
 	}
@@ -53,8 +145,29 @@ void Vic2::Localisations::updateDomainCountry(const std::string& tag, const std:
 }
 
 
+// Only domain names are looked up by their English text, so that mapping is only built once one is needed
+void Vic2::Localisations::importLocalisationToKeyMap()
+{
+	localisationToKeyMapImported = true;
+	for (const auto& file: files)
+	{
+		for (const auto& line: file.lines)
+		{
+			auto division = line.find_first_of(';');
+			const auto english = extractNextLocalisation(line, division);
+			localisationToKeyMap[convertWin125xToUtf8(english, Encoding::Win1252)] = extractKey(line);
+		}
+	}
+}
+
+
 Vic2::LanguageToLocalisationMap Vic2::Localisations::lookupRegionLocalisations(const std::string& domainName)
 {
+	if (!localisationToKeyMapImported)
+	{
+		importLocalisationToKeyMap();
+	}
+
 	LanguageToLocalisationMap regionLocalisations;
 	if (const auto domainKey = localisationToKeyMap.find(domainName); domainKey != localisationToKeyMap.end())
 	{
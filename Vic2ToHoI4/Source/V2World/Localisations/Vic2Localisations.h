@@ -4,9 +4,13 @@
 
 
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 
 
@@ -17,6 +21,14 @@ using LanguageToLocalisationMap = std::map<std::string, std::string>;
 using KeyToLocalisationsMap = std::unordered_map<std::string, LanguageToLocalisationMap>;
 
 
+// The text of a localisation file and its localisation lines, in file order. The lines are views into the text.
+struct LocalisationFile
+{
+	std::unique_ptr<const std::string> text;
+	std::vector<std::string_view> lines;
+};
+
+
 class Localisations
 {
   public:
@@ -26,6 +38,9 @@ class Localisations
 		 localisations(std::move(_localisations)), localisationToKeyMap(std::move(_localisationToKeyMap))
 	{
 	}
+	// The files are in precedence order, later lines for a key overriding earlier ones. Each key's lines are only
+	// converted to UTF-8 when the key is first looked up.
+	explicit Localisations(std::vector<LocalisationFile> _files);
 
 	[[nodiscard]] std::optional<std::string> getTextInLanguage(const std::string& key,
 		 const std::string& language) const;
@@ -34,12 +49,19 @@ class Localisations
 	void updateDomainCountry(const std::string& tag, const std::string& domainName);
 
   private:
+	[[nodiscard]] const LanguageToLocalisationMap* findLocalisations(const std::string& key) const;
+	void importLocalisationToKeyMap();
 	LanguageToLocalisationMap lookupRegionLocalisations(const std::string& domainName);
 	static std::string determineReplacementName(const std::string& domainName,
 		 const LanguageToLocalisationMap& regionLocalisations,
 		 const std::string& language);
 
-	KeyToLocalisationsMap localisations;
+	std::vector<LocalisationFile> files;
+	std::unordered_map<std::string_view, std::vector<std::string_view>> unconvertedLines;
+	bool localisationToKeyMapImported = false;
+
+	mutable std::mutex conversionMutex;
+	mutable KeyToLocalisationsMap localisations;
 	std::map<std::string, std::string> localisationToKeyMap;
 };
 
@@ -47,4 +69,4 @@ class Localisations
 
 
 
-#endif // VIC2_LOCALISATIONS_H
\ No newline at end of file
+#endif // VIC2_LOCALISATIONS_H
@@ -0,0 +1,30 @@
+#ifndef VIC2_WIN125X_CONVERTER_H
+#define VIC2_WIN125X_CONVERTER_H
+
+
+
+#include <string>
+#include <string_view>
+
+
+
+namespace Vic2
+{
+
+enum class Encoding
+{
+	Win1250,
+	Win1251,
+	Win1252,
+};
+
+
+// Converts Windows code page text, as used by Vic2 localisations, to UTF-8. Bytes the code page leaves undefined become
+// the matching C1 control characters, as Windows does.
+[[nodiscard]] std::string convertWin125xToUtf8(std::string_view text, Encoding encoding);
+
+} // namespace Vic2
+
+
+
+#endif // VIC2_WIN125X_CONVERTER_H
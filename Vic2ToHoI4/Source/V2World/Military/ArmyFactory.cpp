@@ -14,28 +14,31 @@ Vic2::Army::Factory::Factory()
 		army->location = commonItems::singleInt{theStream}.getInt();
 	});
 	registerKeyword("regiment", [this](std::istream& theStream) {
-		army->units.push_back(*unitFactory.getUnit(theStream));
+		army->units.push_back(*unitFactory.getUnit(theStream, *warnings));
 	});
 	registerKeyword("ship", [this](std::istream& theStream) {
-		army->units.push_back(*unitFactory.getUnit(theStream));
+		army->units.push_back(*unitFactory.getUnit(theStream, *warnings));
 	});
 	registerKeyword("army", [this](std::istream& theStream) {
 		auto tempArmy = std::move(army);
-		tempArmy->transportedArmies.push_back(*getArmy(tempArmy->owner, theStream));
+		tempArmy->transportedArmies.push_back(*getArmy(tempArmy->owner, theStream, *warnings));
 		army = std::move(tempArmy);
 	});
 	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
 }
 
 
-std::unique_ptr<Vic2::Army> Vic2::Army::Factory::getArmy(std::string owner, std::istream& theStream)
+std::unique_ptr<Vic2::Army> Vic2::Army::Factory::getArmy(std::string owner,
+	 std::istream& theStream,
+	 std::vector<std::string>& warnings)
 {
+	this->warnings = &warnings;
 	army = std::make_unique<Army>();
 	army->owner = std::move(owner);
 	parseStream(theStream);
 	if (army->location == std::nullopt)
 	{
-		Log(LogLevel::Warning) << "Army or Navy " << army->name << " has no location";
+		warnings.push_back("Army or Navy " + army->name + " has no location");
 	}
 	return std::move(army);
 }
\ No newline at end of file
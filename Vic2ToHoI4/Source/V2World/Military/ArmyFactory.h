@@ -7,6 +7,8 @@
 #include "Parser.h"
 #include "UnitFactory.h"
 #include <memory>
+#include <string>
+#include <vector>
 
 
 
@@ -18,10 +20,11 @@ class Army::Factory: commonItems::parser
   public:
 	Factory();
 
-	std::unique_ptr<Army> getArmy(std::string owner, std::istream& theStream);
+	std::unique_ptr<Army> getArmy(std::string owner, std::istream& theStream, std::vector<std::string>& warnings);
 
   private:
 	std::unique_ptr<Army> army;
+	std::vector<std::string>* warnings = nullptr; // those of the army being read
 	Unit::Factory unitFactory;
 };
 
@@ -26,13 +26,13 @@ Vic2::Unit::Factory::Factory()
 }
 
 
-std::unique_ptr<Vic2::Unit> Vic2::Unit::Factory::getUnit(std::istream& theStream)
+std::unique_ptr<Vic2::Unit> Vic2::Unit::Factory::getUnit(std::istream& theStream, std::vector<std::string>& warnings)
 {
 	unit = std::make_unique<Unit>();
 	parseStream(theStream);
 	if (unit->type.empty())
 	{
-		Log(LogLevel::Warning) << "Regiment or Ship " << unit->name << " has no type";
+		warnings.push_back("Regiment or Ship " + unit->name + " has no type");
 	}
 	return std::move(unit);
 }
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include "Parser.h"
 #include "Unit.h"
 #include <memory>
+#include <string>
+#include <vector>
 
 
 
@@ -16,7 +18,7 @@ class Unit::Factory: commonItems::parser
 {
   public:
 	Factory();
-	std::unique_ptr<Unit> getUnit(std::istream& theStream);
+	std::unique_ptr<Unit> getUnit(std::istream& theStream, std::vector<std::string>& warnings);
 
   private:
 	std::unique_ptr<Unit> unit;
@@ -1,13 +1,73 @@
 #include "Pop.h"
+#include <algorithm>
 
 
 
+Vic2::Pop::Pop(): type_(internPopName("")), culture_(internPopName("no_culture"))
+{
+}
+
+
+Vic2::Pop::Pop(const PopOptions& options):
+	 type_(internPopName(options.type)), culture_(internPopName(options.culture)), size_(options.size),
+	 literacy_(options.literacy), militancy_(options.militancy)
+{
+	std::vector<IssueSupport> issues;
+	for (const auto& [issueName, support]: options.popIssues)
+	{
+		issues.push_back({internPopName(issueName), support});
+	}
+	std::ranges::sort(issues, {}, &IssueSupport::issue);
+
+	ownedIssues_ = std::make_shared<const std::vector<IssueSupport>>(std::move(issues));
+	issues_ = *ownedIssues_;
+}
+
+
+Vic2::Pop::Pop(const uint32_t type,
+	 const uint32_t culture,
+	 const int size,
+	 const double literacy,
+	 const double militancy,
+	 std::vector<IssueSupport> issues):
+	 type_(type),
+	 culture_(culture), size_(size), literacy_(literacy), militancy_(militancy),
+	 ownedIssues_(std::make_shared<const std::vector<IssueSupport>>(std::move(issues))), issues_(*ownedIssues_)
+{
+}
+
+
+Vic2::Pop::Pop(const uint32_t type,
+	 const uint32_t culture,
+	 const int size,
+	 const double literacy,
+	 const double militancy,
+	 const std::span<const IssueSupport> issues):
+	 type_(type),
+	 culture_(culture), size_(size), literacy_(literacy), militancy_(militancy), issues_(issues)
+{
+}
+
+
 float Vic2::Pop::getIssueSupport(const std::string& issueName) const
 {
-	if (!popIssues_.contains(issueName))
+	const auto issue = findPopName(issueName);
+	if (!issue)
+	{
+		return 0.0F;
+	}
+
+	return getIssueSupport(*issue);
+}
+
+
+float Vic2::Pop::getIssueSupport(const uint32_t issue) const
+{
+	const auto support = std::ranges::lower_bound(issues_, issue, {}, &IssueSupport::issue);
+	if (support == issues_.end() || support->issue != issue)
 	{
 		return 0.0F;
 	}
 
-	return popIssues_.at(issueName);
-}
\ No newline at end of file
+	return support->support;
+}
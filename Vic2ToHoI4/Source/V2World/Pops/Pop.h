@@ -3,8 +3,13 @@
 
 
 
+#include "V2World/Pops/PopNames.h"
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <span>
 #include <string>
+#include <vector>
 
 
 
@@ -23,36 +28,60 @@ struct PopOptions
 };
 
 
+struct IssueSupport
+{
+	uint32_t issue = 0; // an interned issue name
+	float support = 0.0F;
+};
+
+
+// A pop's names are interned IDs and its issue support is a list sorted by issue ID. Pops kept in a province are views
+// into that province's Pops.
 class Pop
 {
   public:
-	Pop() = default;
-	explicit Pop(const PopOptions& options):
-		 type_(options.type), culture_(options.culture), size_(options.size), literacy_(options.literacy),
-		 militancy_(options.militancy), popIssues_(options.popIssues)
-	{
-	}
-
-	[[nodiscard]] const auto& getType() const { return type_; }
-	[[nodiscard]] const auto& getCulture() const { return culture_; }
+	Pop();
+	explicit Pop(const PopOptions& options);
+	Pop(uint32_t type,
+		 uint32_t culture,
+		 int size,
+		 double literacy,
+		 double militancy,
+		 std::vector<IssueSupport> issues); // issues must be sorted by issue ID
+
+	[[nodiscard]] const std::string& getType() const { return getPopName(type_); }
+	[[nodiscard]] const std::string& getCulture() const { return getPopName(culture_); }
 	[[nodiscard]] const auto& getSize() const { return size_; }
 	[[nodiscard]] const auto& getLiteracy() const { return literacy_; }
 	[[nodiscard]] const auto& getMilitancy() const { return militancy_; }
+	[[nodiscard]] auto getTypeID() const { return type_; }
+	[[nodiscard]] auto getCultureID() const { return culture_; }
+	[[nodiscard]] auto getIssues() const { return issues_; }
 
 	[[nodiscard]] float getIssueSupport(const std::string& issueName) const;
+	[[nodiscard]] float getIssueSupport(uint32_t issue) const;
 
   private:
-	std::string type_;
-	std::string culture_ = "no_culture";
+	friend class Pops;
+	Pop(uint32_t type,
+		 uint32_t culture,
+		 int size,
+		 double literacy,
+		 double militancy,
+		 std::span<const IssueSupport> issues);
+
+	uint32_t type_ = 0;
+	uint32_t culture_ = 0;
 	int size_ = 0;
 	double literacy_ = 0.0;
 	double militancy_ = 0.0;
 
-	std::map<std::string, float> popIssues_;
+	std::shared_ptr<const std::vector<IssueSupport>> ownedIssues_; // empty for views into Pops
+	std::span<const IssueSupport> issues_;
 };
 
 } // namespace Vic2
 
 
 
-#endif // VIC2_POP_H_
\ No newline at end of file
+#endif // VIC2_POP_H_
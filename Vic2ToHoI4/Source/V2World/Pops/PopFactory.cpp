@@ -1,56 +1,126 @@
 #include "PopFactory.h"
-#include "CommonRegexes.h"
-#include "Log.h"
-#include "ParserHelpers.h"
+#include "V2World/Save/SaveKeys.h"
+#include <algorithm>
+#include <charconv>
+#include <optional>
+
+
+
+namespace
+{
+
+enum class PopItem
+{
+	size,
+	literacy,
+	militancy,
+	issues,
+	ignored
+};
+
+
+const Vic2::KeywordTable<PopItem> popItems{{"size", PopItem::size},
+	 {"literacy", PopItem::literacy},
+	 {"mil", PopItem::militancy},
+	 {"issues", PopItem::issues},
+	 {"id", PopItem::ignored},
+	 {"con", PopItem::ignored}};
+
+
+// true only if all of the text is the number
+template <typename Number> bool parseWhole(const std::string_view text, Number& number)
+{
+	const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), number);
+	return error == std::errc() && end == text.data() + text.size();
+}
+
+} // namespace
 
 
 
 Vic2::PopFactory::PopFactory(Issues _theIssues): theIssues(std::move(_theIssues))
 {
-	registerKeyword("size", [this](std::istream& theStream) {
-		popOptions.size = commonItems::singleInt{theStream}.getInt();
-	});
-	registerKeyword("literacy", [this](std::istream& theStream) {
-		popOptions.literacy = commonItems::singleDouble{theStream}.getDouble();
-	});
-	registerKeyword("mil", [this](std::istream& theStream) {
-		popOptions.militancy = commonItems::singleDouble{theStream}.getDouble();
-	});
-	registerKeyword("issues", [this](std::istream& theStream) {
-		for (const auto& [issue, value]: commonItems::assignments{theStream}.getAssignments())
+	// issue numbers outside the known issues have an empty name
+	unknownIssueID_ = internPopName("");
+	for (unsigned int issueNumber = 1;; ++issueNumber)
+	{
+		const auto issueName = theIssues.getIssueName(issueNumber);
+		if (issueName.empty())
 		{
-			try
-			{
-				auto issueName = theIssues.getIssueName(std::stoi(issue));
-				popOptions.popIssues.insert(std::make_pair(issueName, std::stof(value)));
-			}
-			catch (...)
+			break;
+		}
+		issueIDs_.push_back(internPopName(issueName));
+	}
+	noCultureID_ = internPopName("no_culture");
+}
+
+
+Vic2::Pop Vic2::PopFactory::getPop(const std::string_view typeString,
+	 SaveTokenizer& tokenizer,
+	 std::vector<std::string>& warnings)
+{
+	std::optional<uint32_t> culture;
+	int size = 0;
+	double literacy = 0.0;
+	double militancy = 0.0;
+	popIssues_.clear();
+
+	tokenizer.parseBlock([&](const std::string_view key) {
+		const auto item = popItems.find(key);
+		if (!item)
+		{
+			// only the first unrecognized item is actually culture
+			if (!culture)
 			{
-				Log(LogLevel::Warning) << "Poorly formatted pop issue: " << issue << "=" << value;
+				culture = internPopName(key);
 			}
+			tokenizer.skipItem();
+			return;
 		}
-	});
 
-	registerKeyword("id", commonItems::ignoreItem);
-	registerKeyword("con", commonItems::ignoreItem);
-
-	registerRegex(commonItems::catchallRegex, [this](const std::string& cultureString, std::istream& theStream) {
-		// only the first matching item is actually culture
-		if (popOptions.culture == "no_culture")
+		switch (*item)
 		{
-			popOptions.culture = cultureString;
+			case PopItem::size:
+				size = tokenizer.getInt();
+				break;
+			case PopItem::literacy:
+				literacy = tokenizer.getDouble();
+				break;
+			case PopItem::militancy:
+				militancy = tokenizer.getDouble();
+				break;
+			case PopItem::issues:
+				importIssues(tokenizer, warnings);
+				break;
+			case PopItem::ignored:
+				tokenizer.skipItem();
+				break;
 		}
-		commonItems::ignoreItem(cultureString, theStream);
 	});
+
+	// when an issue is listed twice, the first listing counts
+	std::ranges::stable_sort(popIssues_, {}, &IssueSupport::issue);
+	const auto duplicates = std::ranges::unique(popIssues_, {}, &IssueSupport::issue);
+	popIssues_.erase(duplicates.begin(), duplicates.end());
+
+	return {internPopName(typeString), culture.value_or(noCultureID_), size, literacy, militancy, popIssues_};
 }
 
 
-Vic2::Pop Vic2::PopFactory::getPop(const std::string& typeString, std::istream& theStream)
+void Vic2::PopFactory::importIssues(SaveTokenizer& tokenizer, std::vector<std::string>& warnings)
 {
-	popOptions = PopOptions();
-	popOptions.type = typeString;
-
-	parseStream(theStream);
+	tokenizer.parseAssignments([this, &warnings](const std::string_view issue, const std::string_view value) {
+		int issueNumber = 0;
+		float support = 0.0F;
+		if (!parseWhole(issue, issueNumber) || !parseWhole(value, support))
+		{
+			warnings.push_back("Poorly formatted pop issue: " + std::string(issue) + "=" + std::string(value));
+			return;
+		}
 
-	return Pop(popOptions);
-}
\ No newline at end of file
+		const auto issueID = (issueNumber >= 1 && issueNumber <= static_cast<int>(issueIDs_.size()))
+										 ? issueIDs_[issueNumber - 1]
+										 : unknownIssueID_;
+		popIssues_.push_back({issueID, support});
+	});
+}
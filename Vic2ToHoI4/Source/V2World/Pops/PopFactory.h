@@ -3,29 +3,38 @@
 
 
 
-#include "Parser.h"
 #include "Pop.h"
 #include "V2World/Issues/Issues.h"
-#include <memory>
+#include "V2World/Save/SaveTokenizer.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
 
 
 
 namespace Vic2
 {
 
-class PopFactory: commonItems::parser
+class PopFactory
 {
   public:
 	explicit PopFactory(Issues _theIssues);
-	Pop getPop(const std::string& typeString, std::istream& theStream);
+	Pop getPop(std::string_view typeString, SaveTokenizer& tokenizer, std::vector<std::string>& warnings);
 
   private:
-	PopOptions popOptions;
+	void importIssues(SaveTokenizer& tokenizer, std::vector<std::string>& warnings);
+
 	const Issues theIssues;
+	std::vector<uint32_t> issueIDs_; // the interned name of each issue, by issue number - 1
+	uint32_t unknownIssueID_ = 0;
+	uint32_t noCultureID_ = 0;
+
+	std::vector<IssueSupport> popIssues_;
 };
 
 } // namespace Vic2
 
 
 
-#endif // POP_FACTORY_H
\ No newline at end of file
+#endif // POP_FACTORY_H
@@ -0,0 +1,88 @@
+#include "PopNames.h"
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+
+
+namespace
+{
+
+class PopNames
+{
+  public:
+	uint32_t intern(std::string_view name);
+	std::optional<uint32_t> find(std::string_view name) const;
+	const std::string& get(uint32_t id) const;
+
+  private:
+	mutable std::shared_mutex mutex_;
+	std::deque<std::string> names_; // a deque, so the views in ids_ stay valid as names are added
+	std::unordered_map<std::string_view, uint32_t> ids_;
+};
+
+
+uint32_t PopNames::intern(const std::string_view name)
+{
+	if (const auto id = find(name); id)
+	{
+		return *id;
+	}
+
+	std::unique_lock lock(mutex_);
+	if (const auto existing = ids_.find(name); existing != ids_.end())
+	{
+		return existing->second;
+	}
+	const auto id = static_cast<uint32_t>(names_.size());
+	names_.emplace_back(name);
+	ids_.emplace(names_.back(), id);
+	return id;
+}
+
+
+std::optional<uint32_t> PopNames::find(const std::string_view name) const
+{
+	std::shared_lock lock(mutex_);
+	if (const auto id = ids_.find(name); id != ids_.end())
+	{
+		return id->second;
+	}
+	return std::nullopt;
+}
+
+
+const std::string& PopNames::get(const uint32_t id) const
+{
+	std::shared_lock lock(mutex_);
+	return names_.at(id);
+}
+
+
+PopNames& getPopNames()
+{
+	static PopNames popNames;
+	return popNames;
+}
+
+} // namespace
+
+
+
+uint32_t Vic2::internPopName(const std::string_view name)
+{
+	return getPopNames().intern(name);
+}
+
+
+std::optional<uint32_t> Vic2::findPopName(const std::string_view name)
+{
+	return getPopNames().find(name);
+}
+
+
+const std::string& Vic2::getPopName(const uint32_t id)
+{
+	return getPopNames().get(id);
+}
@@ -0,0 +1,26 @@
+#ifndef VIC2_POP_NAMES_H
+#define VIC2_POP_NAMES_H
+
+
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+
+
+namespace Vic2
+{
+
+// Pop types, cultures and issue names are shared by many pops, so each name is stored once and pops refer to it by ID.
+// IDs are stable for the whole run and the functions are safe to call from several threads.
+[[nodiscard]] uint32_t internPopName(std::string_view name);
+[[nodiscard]] std::optional<uint32_t> findPopName(std::string_view name);
+[[nodiscard]] const std::string& getPopName(uint32_t id);
+
+} // namespace Vic2
+
+
+
+#endif // VIC2_POP_NAMES_H
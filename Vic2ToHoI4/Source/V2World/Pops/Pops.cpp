@@ -0,0 +1,107 @@
+#include "Pops.h"
+#include <algorithm>
+
+
+
+namespace
+{
+
+constexpr double minimumLiteracyWeighting = 0.1;
+constexpr double literacyWeighting = 0.9;
+int calculateLiteracyWeightedPop(const int size, const double literacy)
+{
+	return static_cast<int>(size * (literacy * literacyWeighting + minimumLiteracyWeighting));
+}
+
+} // namespace
+
+
+
+Vic2::Pops::Pops(const std::vector<Pop>& pops)
+{
+	for (const auto& pop: pops)
+	{
+		push_back(pop);
+	}
+}
+
+
+void Vic2::Pops::push_back(const Pop& pop)
+{
+	types_.push_back(pop.getTypeID());
+	cultures_.push_back(pop.getCultureID());
+	sizes_.push_back(pop.getSize());
+	literacies_.push_back(pop.getLiteracy());
+	militancies_.push_back(pop.getMilitancy());
+	issues_.insert(issues_.end(), pop.getIssues().begin(), pop.getIssues().end());
+	issueOffsets_.push_back(static_cast<uint32_t>(issues_.size()));
+
+	addToTotals(pop);
+}
+
+
+Vic2::Pop Vic2::Pops::operator[](const size_t index) const
+{
+	const std::span<const IssueSupport> issues(issues_.data() + issueOffsets_[index],
+		 issueOffsets_[index + 1] - issueOffsets_[index]);
+	return {types_[index], cultures_[index], sizes_[index], literacies_[index], militancies_[index], issues};
+}
+
+
+int Vic2::Pops::getPopulation(const uint32_t type) const
+{
+	const auto* typeTotals = findTypeTotals(type);
+	return typeTotals ? typeTotals->population : 0;
+}
+
+
+int Vic2::Pops::getLiteracyWeightedPopulation(const uint32_t type) const
+{
+	const auto* typeTotals = findTypeTotals(type);
+	return typeTotals ? typeTotals->literacyWeightedPopulation : 0;
+}
+
+
+void Vic2::Pops::addToTotals(const Pop& pop)
+{
+	const auto literacyWeightedPopulation = calculateLiteracyWeightedPop(pop.getSize(), pop.getLiteracy());
+	population_ += pop.getSize();
+	literacyWeightedPopulation_ += literacyWeightedPopulation;
+
+	auto typeTotals = std::ranges::find(typeTotals_, pop.getTypeID(), &PopTypeTotals::type);
+	if (typeTotals == typeTotals_.end())
+	{
+		typeTotals = typeTotals_.insert(typeTotals_.end(), {pop.getTypeID()});
+	}
+	typeTotals->population += pop.getSize();
+	typeTotals->literacyWeightedPopulation += literacyWeightedPopulation;
+
+	auto cultureTotal = std::ranges::find(cultureTotals_, pop.getCultureID(), &CultureTotal::culture);
+	if (cultureTotal == cultureTotals_.end())
+	{
+		cultureTotal = cultureTotals_.insert(cultureTotals_.end(), {pop.getCultureID()});
+	}
+	cultureTotal->population += pop.getSize();
+
+	for (const auto& [issue, support]: pop.getIssues())
+	{
+		auto issueTotal = std::ranges::lower_bound(issueTotals_, issue, {}, &IssueTotal::issue);
+		if (issueTotal == issueTotals_.end() || issueTotal->issue != issue)
+		{
+			issueTotal = issueTotals_.insert(issueTotal, {issue});
+		}
+		issueTotal->weightedSupport += static_cast<double>(support) * pop.getSize();
+	}
+}
+
+
+const Vic2::PopTypeTotals* Vic2::Pops::findTypeTotals(const uint32_t type) const
+{
+	// a province has at most a dozen or so pop types, so a scan beats a hash
+	const auto typeTotals = std::ranges::find(typeTotals_, type, &PopTypeTotals::type);
+	if (typeTotals == typeTotals_.end())
+	{
+		return nullptr;
+	}
+	return &*typeTotals;
+}
@@ -0,0 +1,109 @@
+#ifndef VIC2_POPS_H
+#define VIC2_POPS_H
+
+
+
+#include "V2World/Pops/Pop.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+
+namespace Vic2
+{
+
+struct PopTypeTotals
+{
+	uint32_t type = 0;
+	int population = 0;
+	int literacyWeightedPopulation = 0;
+};
+
+
+struct CultureTotal
+{
+	uint32_t culture = 0;
+	int population = 0;
+};
+
+
+struct IssueTotal
+{
+	uint32_t issue = 0;
+	double weightedSupport = 0.0; // the sum of support * size
+};
+
+
+// A province's pops, stored column by column. Reading a pop gives a Pop that views this storage. Totals by pop type,
+// culture and issue are kept as pops are added, so they can be looked up without walking the pops.
+class Pops
+{
+  public:
+	class const_iterator
+	{
+	  public:
+		const_iterator(const Pops& pops, const size_t index): pops_(&pops), index_(index) {}
+
+		Pop operator*() const { return (*pops_)[index_]; }
+		const_iterator& operator++()
+		{
+			++index_;
+			return *this;
+		}
+		bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+
+	  private:
+		const Pops* pops_;
+		size_t index_;
+	};
+
+	Pops() = default;
+	explicit Pops(const std::vector<Pop>& pops);
+
+	void push_back(const Pop& pop);
+
+	[[nodiscard]] size_t size() const { return types_.size(); }
+	[[nodiscard]] bool empty() const { return types_.empty(); }
+	[[nodiscard]] Pop operator[](size_t index) const;
+	[[nodiscard]] const_iterator begin() const { return {*this, 0}; }
+	[[nodiscard]] const_iterator end() const { return {*this, size()}; }
+
+	[[nodiscard]] const auto& getTypeIDs() const { return types_; }
+	[[nodiscard]] const auto& getCultureIDs() const { return cultures_; }
+	[[nodiscard]] const auto& getSizes() const { return sizes_; }
+	[[nodiscard]] const auto& getLiteracies() const { return literacies_; }
+
+	[[nodiscard]] int getPopulation() const { return population_; }
+	[[nodiscard]] int getPopulation(uint32_t type) const;
+	[[nodiscard]] int getLiteracyWeightedPopulation() const { return literacyWeightedPopulation_; }
+	[[nodiscard]] int getLiteracyWeightedPopulation(uint32_t type) const;
+	[[nodiscard]] const auto& getCultureTotals() const { return cultureTotals_; }
+	[[nodiscard]] const auto& getIssueTotals() const { return issueTotals_; }
+
+  private:
+	void addToTotals(const Pop& pop);
+	[[nodiscard]] const PopTypeTotals* findTypeTotals(uint32_t type) const;
+
+	std::vector<uint32_t> types_;
+	std::vector<uint32_t> cultures_;
+	std::vector<int> sizes_;
+	std::vector<double> literacies_;
+	std::vector<double> militancies_;
+
+	// pop N's issues are issues_[issueOffsets_[N]] up to issues_[issueOffsets_[N + 1]]
+	std::vector<uint32_t> issueOffsets_{0};
+	std::vector<IssueSupport> issues_;
+
+	int population_ = 0;
+	int literacyWeightedPopulation_ = 0;
+	std::vector<PopTypeTotals> typeTotals_;
+	std::vector<CultureTotal> cultureTotals_;
+	std::vector<IssueTotal> issueTotals_; // sorted by issue
+};
+
+} // namespace Vic2
+
+
+
+#endif // VIC2_POPS_H
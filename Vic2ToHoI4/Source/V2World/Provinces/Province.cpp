@@ -10,58 +10,47 @@ int Vic2::Province::getTotalPopulation() const
 
 int Vic2::Province::getPopulation(const std::optional<std::string>& type) const
 {
-	auto totalPopulation = 0;
-	for (const auto& pop: pops)
+	if (!type)
 	{
-		if (!type || *type == pop.getType())
-		{
-			totalPopulation += pop.getSize();
-		}
+		return pops.getPopulation();
 	}
-
-	return totalPopulation;
+	if (const auto popType = findPopName(*type); popType)
+	{
+		return pops.getPopulation(*popType);
+	}
+	return 0;
 }
 
 
 int Vic2::Province::getLiteracyWeightedPopulation(const std::optional<std::string>& type) const
 {
-	auto totalPopulation = 0;
-	for (const auto& pop: pops)
+	if (!type)
 	{
-		if (!type || *type == pop.getType())
-		{
-			totalPopulation += calculateLiteracyWeightedPop(pop);
-		}
+		return pops.getLiteracyWeightedPopulation();
+	}
+	if (const auto popType = findPopName(*type); popType)
+	{
+		return pops.getLiteracyWeightedPopulation(*popType);
 	}
-	return totalPopulation;
+	return 0;
 }
 
 
 double Vic2::Province::getPercentageWithCultures(const std::set<std::string>& cultures) const
 {
-	auto totalPopulation = 0;
-	auto populationOfCultures = 0;
-
-	for (const auto& pop: pops)
+	const auto totalPopulation = pops.getPopulation();
+	if (totalPopulation <= 0)
 	{
-		totalPopulation += pop.getSize();
-		if (cultures.contains(pop.getCulture()))
-		{
-			populationOfCultures += pop.getSize();
-		}
+		return 0.0;
 	}
 
-	if (totalPopulation <= 0)
+	auto populationOfCultures = 0;
+	for (const auto& [culture, population]: pops.getCultureTotals())
 	{
-		return 0.0;
+		if (cultures.contains(getPopName(culture)))
+		{
+			populationOfCultures += population;
+		}
 	}
 	return 1.0 * populationOfCultures / totalPopulation;
 }
-
-
-constexpr double minimumLiteracyWeighting = 0.1;
-constexpr double literacyWeighting = 0.9;
-int Vic2::Province::calculateLiteracyWeightedPop(const Pop& thePop)
-{
-	return static_cast<int>(thePop.getSize() * (thePop.getLiteracy() * literacyWeighting + minimumLiteracyWeighting));
-}
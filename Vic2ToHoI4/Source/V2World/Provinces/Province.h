@@ -5,6 +5,8 @@
 
 #include "V2World/Pops/Pop.h"
 #include "V2World/Pops/PopFactory.h"
+#include "V2World/Pops/Pops.h"
+#include <cstdint>
 #include <optional>
 #include <set>
 #include <string>
@@ -24,7 +26,12 @@ class Province
 
 	[[nodiscard]] int getTotalPopulation() const;
 	[[nodiscard]] int getPopulation(const std::optional<std::string>& type = {}) const;
+	[[nodiscard]] int getPopulation(uint32_t popType) const { return pops.getPopulation(popType); }
 	[[nodiscard]] int getLiteracyWeightedPopulation(const std::optional<std::string>& type = {}) const;
+	[[nodiscard]] int getLiteracyWeightedPopulation(uint32_t popType) const
+	{
+		return pops.getLiteracyWeightedPopulation(popType);
+	}
 	[[nodiscard]] double getPercentageWithCultures(const std::set<std::string>& cultures) const;
 
 	void setOwner(const std::string& _owner) { owner = _owner; }
@@ -42,8 +49,6 @@ class Province
 	[[nodiscard]] const auto& getFlags() const { return flags; }
 
   private:
-	[[nodiscard]] static int calculateLiteracyWeightedPop(const Pop& thePop);
-
 	int number = 0;
 
 	bool landProvince_ = false;
@@ -52,7 +57,7 @@ class Province
 	std::string controller;
 	std::set<std::string> cores;
 
-	std::vector<Pop> pops;
+	Pops pops;
 
 	int navalBaseLevel = 0;
 	int railLevel = 0;
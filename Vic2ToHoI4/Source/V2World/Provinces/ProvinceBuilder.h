@@ -58,9 +58,9 @@ class Province::Builder
 		return *this;
 	}
 
-	Builder& setPops(std::vector<Pop> pops)
+	Builder& setPops(const std::vector<Pop>& pops)
 	{
-		province->pops = std::move(pops);
+		province->pops = Pops(pops);
 		return *this;
 	}
 
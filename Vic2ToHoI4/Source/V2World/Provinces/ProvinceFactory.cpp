@@ -1,54 +1,118 @@
 #include "ProvinceFactory.h"
-#include "CommonRegexes.h"
-#include "ParserHelpers.h"
-#include <ranges>
+#include "V2World/Save/SaveKeys.h"
+
+
+
+namespace
+{
+
+enum class ProvinceItem
+{
+	owner,
+	core,
+	controller,
+	navalBase,
+	railroad,
+	pop,
+	flags,
+	lifeRating
+};
+
+
+const Vic2::KeywordTable<ProvinceItem> provinceItems{{"owner", ProvinceItem::owner},
+	 {"core", ProvinceItem::core},
+	 {"controller", ProvinceItem::controller},
+	 {"naval_base", ProvinceItem::navalBase},
+	 {"railroad", ProvinceItem::railroad},
+	 {"flags", ProvinceItem::flags},
+	 {"life_rating", ProvinceItem::lifeRating},
+	 {"aristocrats", ProvinceItem::pop},
+	 {"artisans", ProvinceItem::pop},
+	 {"bureaucrats", ProvinceItem::pop},
+	 {"capitalists", ProvinceItem::pop},
+	 {"clergymen", ProvinceItem::pop},
+	 {"craftsmen", ProvinceItem::pop},
+	 {"clerks", ProvinceItem::pop},
+	 {"farmers", ProvinceItem::pop},
+	 {"soldiers", ProvinceItem::pop},
+	 {"officers", ProvinceItem::pop},
+	 {"labourers", ProvinceItem::pop},
+	 {"slaves", ProvinceItem::pop},
+	 {"serfs", ProvinceItem::pop}};
+
+
+int getFirstLevel(const std::vector<double>& levels)
+{
+	if (levels.empty())
+	{
+		return 0;
+	}
+	return static_cast<int>(levels[0]);
+}
+
+} // namespace
 
 
 
 Vic2::Province::Factory::Factory(std::unique_ptr<PopFactory>&& _popFactory): popFactory(std::move(_popFactory))
 {
-	registerKeyword("owner", [this](std::istream& theStream) {
-		province->owner = commonItems::singleString(theStream).getString();
-	});
-	registerKeyword("core", [this](std::istream& theStream) {
-		province->cores.insert(commonItems::singleString(theStream).getString());
-	});
-	registerKeyword("controller", [this](std::istream& theStream) {
-		province->controller = commonItems::singleString(theStream).getString();
-	});
-	registerKeyword("naval_base", [this](std::istream& theStream) {
-		province->navalBaseLevel = static_cast<int>(commonItems::doubleList(theStream).getDoubles()[0]);
-	});
-	registerKeyword("railroad", [this](std::istream& theStream) {
-		province->railLevel = static_cast<int>(commonItems::doubleList(theStream).getDoubles()[0]);
-	});
-	registerRegex(
-		 "aristocrats|artisans|bureaucrats|capitalists|clergymen|craftsmen|clerks|farmers|soldiers|officers|labourers|"
-		 "slaves|serfs",
-		 [this](const std::string& popType, std::istream& theStream) {
-			 province->pops.push_back(popFactory->getPop(popType, theStream));
-		 });
-	registerKeyword("flags", [this](std::istream& theStream) {
-		const auto assignments = commonItems::assignments(theStream).getAssignments();
-		for (const auto& flag: assignments | std::views::keys)
-		{
-			province->flags.insert(flag);
-		}
-	});
-	registerKeyword("life_rating", [this](std::istream& theStream) {
-		province->landProvince_ = true;
-		const auto unused = commonItems::getInt(theStream);
-	});
-	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
 }
 
 
-std::unique_ptr<Vic2::Province> Vic2::Province::Factory::getProvince(int number, std::istream& theStream)
+std::unique_ptr<Vic2::Province> Vic2::Province::Factory::getProvince(int number,
+	 SaveTokenizer& tokenizer,
+	 std::vector<std::string>& warnings)
 {
 	province = std::make_unique<Province>();
 	province->number = number;
 
-	parseStream(theStream);
+	tokenizer.parseBlock([this, &tokenizer, &warnings](const std::string_view key) {
+		importItem(key, tokenizer, warnings);
+	});
 
 	return std::move(province);
-}
\ No newline at end of file
+}
+
+
+void Vic2::Province::Factory::importItem(const std::string_view key,
+	 SaveTokenizer& tokenizer,
+	 std::vector<std::string>& warnings)
+{
+	const auto item = provinceItems.find(key);
+	if (!item)
+	{
+		tokenizer.skipItem();
+		return;
+	}
+
+	switch (*item)
+	{
+		case ProvinceItem::owner:
+			province->owner = tokenizer.getString();
+			break;
+		case ProvinceItem::core:
+			province->cores.insert(std::string(tokenizer.getString()));
+			break;
+		case ProvinceItem::controller:
+			province->controller = tokenizer.getString();
+			break;
+		case ProvinceItem::navalBase:
+			province->navalBaseLevel = getFirstLevel(tokenizer.getDoubles());
+			break;
+		case ProvinceItem::railroad:
+			province->railLevel = getFirstLevel(tokenizer.getDoubles());
+			break;
+		case ProvinceItem::pop:
+			province->pops.push_back(popFactory->getPop(key, tokenizer, warnings));
+			break;
+		case ProvinceItem::flags:
+			tokenizer.parseAssignments([this](const std::string_view flag, std::string_view) {
+				province->flags.insert(std::string(flag));
+			});
+			break;
+		case ProvinceItem::lifeRating:
+			province->landProvince_ = true;
+			tokenizer.skipItem();
+			break;
+	}
+}
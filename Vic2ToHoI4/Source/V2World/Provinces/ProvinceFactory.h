@@ -3,22 +3,26 @@
 
 
 
-#include "Parser.h"
 #include "Province.h"
+#include "V2World/Save/SaveTokenizer.h"
 #include <memory>
+#include <string>
+#include <vector>
 
 
 
 namespace Vic2
 {
 
-class Province::Factory: commonItems::parser
+class Province::Factory
 {
   public:
 	explicit Factory(std::unique_ptr<PopFactory>&& _popFactory);
-	std::unique_ptr<Province> getProvince(int number, std::istream& theStream);
+	std::unique_ptr<Province> getProvince(int number, SaveTokenizer& tokenizer, std::vector<std::string>& warnings);
 
   private:
+	void importItem(std::string_view key, SaveTokenizer& tokenizer, std::vector<std::string>& warnings);
+
 	std::unique_ptr<Province> province;
 	std::unique_ptr<PopFactory> popFactory;
 };
@@ -27,4 +31,4 @@ class Province::Factory: commonItems::parser
 
 
 
-#endif // PROVINCE_FACTORY_H
\ No newline at end of file
+#endif // PROVINCE_FACTORY_H
@@ -0,0 +1,141 @@
+#include "SaveFile.h"
+#include <stdexcept>
+#include <string>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+
+#ifdef _WIN32
+
+namespace
+{
+
+// paths from the configuration are UTF-8, which the narrow Windows functions would read in the local code page
+std::wstring convertPathToWide(const std::string& path)
+{
+	const auto size = MultiByteToWideChar(CP_UTF8, 0, path.data(), static_cast<int>(path.size()), nullptr, 0);
+	std::wstring widePath(static_cast<size_t>(size), L'\0');
+	MultiByteToWideChar(CP_UTF8, 0, path.data(), static_cast<int>(path.size()), widePath.data(), size);
+	return widePath;
+}
+
+} // namespace
+
+
+
+Vic2::SaveFile::SaveFile(const std::string& path)
+{
+	fileHandle_ = CreateFileW(convertPathToWide(path).c_str(),
+		 GENERIC_READ,
+		 FILE_SHARE_READ,
+		 nullptr,
+		 OPEN_EXISTING,
+		 FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+		 nullptr);
+	if (fileHandle_ == INVALID_HANDLE_VALUE)
+	{
+		fileHandle_ = nullptr;
+		throw std::runtime_error("Could not open " + path);
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(fileHandle_, &fileSize))
+	{
+		CloseHandle(fileHandle_);
+		throw std::runtime_error("Could not read the size of " + path);
+	}
+	size_ = static_cast<size_t>(fileSize.QuadPart);
+	if (size_ == 0)
+	{
+		return;
+	}
+
+	mappingHandle_ = CreateFileMappingW(fileHandle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mappingHandle_ == nullptr)
+	{
+		CloseHandle(fileHandle_);
+		throw std::runtime_error("Could not map " + path);
+	}
+	data_ = static_cast<const char*>(MapViewOfFile(mappingHandle_, FILE_MAP_READ, 0, 0, 0));
+	if (data_ == nullptr)
+	{
+		CloseHandle(mappingHandle_);
+		CloseHandle(fileHandle_);
+		throw std::runtime_error("Could not map " + path);
+	}
+}
+
+
+Vic2::SaveFile::~SaveFile()
+{
+	if (data_ != nullptr)
+	{
+		UnmapViewOfFile(data_);
+	}
+	if (mappingHandle_ != nullptr)
+	{
+		CloseHandle(mappingHandle_);
+	}
+	if (fileHandle_ != nullptr)
+	{
+		CloseHandle(fileHandle_);
+	}
+}
+
+#else
+
+Vic2::SaveFile::SaveFile(const std::string& path)
+{
+	fileDescriptor_ = open(path.c_str(), O_RDONLY);
+	if (fileDescriptor_ == -1)
+	{
+		throw std::runtime_error("Could not open " + path);
+	}
+
+	struct stat fileStatus
+	{
+	};
+	if (fstat(fileDescriptor_, &fileStatus) == -1)
+	{
+		close(fileDescriptor_);
+		throw std::runtime_error("Could not read the size of " + path);
+	}
+	size_ = static_cast<size_t>(fileStatus.st_size);
+	if (size_ == 0)
+	{
+		return;
+	}
+
+	void* mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fileDescriptor_, 0);
+	if (mapping == MAP_FAILED)
+	{
+		close(fileDescriptor_);
+		throw std::runtime_error("Could not map " + path);
+	}
+	madvise(mapping, size_, MADV_SEQUENTIAL);
+	data_ = static_cast<const char*>(mapping);
+}
+
+
+Vic2::SaveFile::~SaveFile()
+{
+	if (data_ != nullptr)
+	{
+		munmap(const_cast<char*>(data_), size_);
+	}
+	if (fileDescriptor_ != -1)
+	{
+		close(fileDescriptor_);
+	}
+}
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef VIC2_SAVE_FILE_H
+#define VIC2_SAVE_FILE_H
+
+
+
+#include <string>
+#include <string_view>
+
+
+
+namespace Vic2
+{
+
+// A save file mapped into memory, so it can be read without copying it into strings
+class SaveFile
+{
+  public:
+	// throws if the file can't be opened
+	explicit SaveFile(const std::string& path);
+	~SaveFile();
+
+	SaveFile(const SaveFile&) = delete;
+	SaveFile& operator=(const SaveFile&) = delete;
+	SaveFile(SaveFile&&) = delete;
+	SaveFile& operator=(SaveFile&&) = delete;
+
+	[[nodiscard]] std::string_view getContents() const { return {data_, size_}; }
+
+  private:
+#ifdef _WIN32
+	void* fileHandle_ = nullptr;
+	void* mappingHandle_ = nullptr;
+#else
+	int fileDescriptor_ = -1;
+#endif
+	const char* data_ = nullptr;
+	size_t size_ = 0;
+};
+
+} // namespace Vic2
+
+
+
+#endif // VIC2_SAVE_FILE_H
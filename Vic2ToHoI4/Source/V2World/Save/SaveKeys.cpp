@@ -0,0 +1,47 @@
+#include "V2World/Save/SaveKeys.h"
+#include <algorithm>
+
+
+
+namespace
+{
+
+bool isDigit(const char character)
+{
+	return character >= '0' && character <= '9';
+}
+
+
+bool isUppercase(const char character)
+{
+	return character >= 'A' && character <= 'Z';
+}
+
+} // namespace
+
+
+
+bool Vic2::isProvinceNumber(const std::string_view key)
+{
+	return !key.empty() && std::ranges::all_of(key, isDigit);
+}
+
+
+bool Vic2::isCountryTag(const std::string_view key)
+{
+	return key.size() == 3 && isUppercase(key[0]) && (isUppercase(key[1]) || isDigit(key[1])) &&
+			 (isUppercase(key[2]) || isDigit(key[2]));
+}
+
+
+uint32_t Vic2::hashKey(const std::string_view key, const uint32_t seed)
+{
+	// FNV-1a, with the seed mixed into the offset basis
+	uint32_t hash = 2166136261U ^ (seed * 16777619U);
+	for (const auto character: key)
+	{
+		hash ^= static_cast<unsigned char>(character);
+		hash *= 16777619U;
+	}
+	return hash ^ (hash >> 15);
+}
@@ -0,0 +1,119 @@
+#ifndef VIC2_SAVE_KEYS_H
+#define VIC2_SAVE_KEYS_H
+
+
+
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+
+
+namespace Vic2
+{
+
+// matches \d+
+[[nodiscard]] bool isProvinceNumber(std::string_view key);
+
+// matches [A-Z][A-Z0-9]{2}
+[[nodiscard]] bool isCountryTag(std::string_view key);
+
+[[nodiscard]] uint32_t hashKey(std::string_view key, uint32_t seed);
+
+
+// A fixed set of keys with a collision-free hash, so looking up a key costs one hash and one comparison.
+// The keys must outlive the table, which they do when they're string literals, and must all be different.
+template <typename Value> class KeywordTable
+{
+  public:
+	KeywordTable(std::initializer_list<std::pair<std::string_view, Value>> keywords);
+
+	[[nodiscard]] std::optional<Value> find(std::string_view key) const;
+
+  private:
+	[[nodiscard]] bool tryToFill(uint32_t seed, size_t size);
+
+	std::vector<std::pair<std::string_view, Value>> keywords_;
+	std::vector<int> slots_; // index into keywords_, or -1
+	uint32_t seed_ = 0;
+	uint32_t mask_ = 0;
+};
+
+
+template <typename Value>
+KeywordTable<Value>::KeywordTable(std::initializer_list<std::pair<std::string_view, Value>> keywords):
+	 keywords_(keywords)
+{
+	// no hash can separate a key from itself, so a repeated key would make the search below run forever
+	std::unordered_set<std::string_view> seenKeys;
+	for (const auto& key: keywords_ | std::views::keys)
+	{
+		if (!seenKeys.insert(key).second)
+		{
+			throw std::runtime_error("Keyword " + std::string(key) + " is listed twice");
+		}
+	}
+
+	size_t size = 1;
+	while (size < keywords_.size() * 2)
+	{
+		size *= 2;
+	}
+
+	// distinct keys are separated well before this, so only a broken hash could get here
+	constexpr size_t maxSize = 1 << 16;
+	for (uint32_t seed = 0; size <= maxSize; ++seed)
+	{
+		if (tryToFill(seed, size))
+		{
+			return;
+		}
+		if (seed % 1024 == 1023)
+		{
+			size *= 2;
+		}
+	}
+	throw std::runtime_error("Could not find a collision-free hash for the keywords");
+}
+
+
+template <typename Value> std::optional<Value> KeywordTable<Value>::find(const std::string_view key) const
+{
+	const auto index = slots_[hashKey(key, seed_) & mask_];
+	if (index < 0 || keywords_[index].first != key)
+	{
+		return std::nullopt;
+	}
+	return keywords_[index].second;
+}
+
+
+template <typename Value> bool KeywordTable<Value>::tryToFill(const uint32_t seed, const size_t size)
+{
+	slots_.assign(size, -1);
+	seed_ = seed;
+	mask_ = static_cast<uint32_t>(size - 1);
+	for (size_t i = 0; i < keywords_.size(); ++i)
+	{
+		auto& slot = slots_[hashKey(keywords_[i].first, seed_) & mask_];
+		if (slot != -1)
+		{
+			return false;
+		}
+		slot = static_cast<int>(i);
+	}
+	return true;
+}
+
+} // namespace Vic2
+
+
+
+#endif // VIC2_SAVE_KEYS_H
@@ -0,0 +1,314 @@
+#include "V2World/Save/SaveTokenizer.h"
+#include <algorithm>
+#include <charconv>
+#include <type_traits>
+
+
+
+namespace
+{
+
+bool isWhitespace(const char character)
+{
+	return character == ' ' || character == '\t' || character == '\r' || character == '\n';
+}
+
+
+bool isSeparator(const char character)
+{
+	return isWhitespace(character) || character == '{' || character == '}' || character == '=' || character == '#';
+}
+
+} // namespace
+
+
+
+std::optional<std::string_view> Vic2::SaveTokenizer::getNextToken()
+{
+	while (position_ < text_.size())
+	{
+		if (isWhitespace(text_[position_]))
+		{
+			++position_;
+		}
+		else if (text_[position_] == '#')
+		{
+			position_ = text_.find('\n', position_);
+			if (position_ == std::string_view::npos)
+			{
+				position_ = text_.size();
+			}
+		}
+		else
+		{
+			break;
+		}
+	}
+	if (position_ >= text_.size())
+	{
+		return std::nullopt;
+	}
+
+	const auto start = position_;
+	if (text_[position_] == '{' || text_[position_] == '}' || text_[position_] == '=')
+	{
+		++position_;
+	}
+	else if (text_[position_] == '"')
+	{
+		skipQuotedString();
+	}
+	else
+	{
+		while (position_ < text_.size() && !isSeparator(text_[position_]))
+		{
+			++position_;
+		}
+	}
+
+	return text_.substr(start, position_ - start);
+}
+
+
+std::optional<std::string_view> Vic2::SaveTokenizer::peekToken()
+{
+	const auto position = position_;
+	const auto token = getNextToken();
+	position_ = position;
+	return token;
+}
+
+
+std::string_view Vic2::SaveTokenizer::getString()
+{
+	skipEquals();
+	const auto token = peekToken();
+	if (!token || *token == "{" || *token == "}")
+	{
+		return {};
+	}
+	return removeQuotes(*getNextToken());
+}
+
+
+int Vic2::SaveTokenizer::getInt()
+{
+	return toNumber<int>(getString());
+}
+
+
+double Vic2::SaveTokenizer::getDouble()
+{
+	return toNumber<double>(getString());
+}
+
+
+std::vector<int> Vic2::SaveTokenizer::getInts()
+{
+	std::vector<int> ints;
+	for (const auto& string: getStrings())
+	{
+		ints.push_back(toNumber<int>(string));
+	}
+	return ints;
+}
+
+
+std::vector<double> Vic2::SaveTokenizer::getDoubles()
+{
+	std::vector<double> doubles;
+	for (const auto& string: getStrings())
+	{
+		doubles.push_back(toNumber<double>(string));
+	}
+	return doubles;
+}
+
+
+std::vector<std::string_view> Vic2::SaveTokenizer::getStrings()
+{
+	std::vector<std::string_view> strings;
+
+	skipEquals();
+	if (const auto token = peekToken(); token && *token != "{")
+	{
+		if (*token != "}")
+		{
+			strings.push_back(removeQuotes(*getNextToken()));
+		}
+		return strings;
+	}
+
+	parseBlock([this, &strings](const std::string_view token) {
+		strings.push_back(removeQuotes(token));
+	});
+	return strings;
+}
+
+
+std::string_view Vic2::SaveTokenizer::getItem()
+{
+	skipEquals();
+	const auto token = peekToken();
+	if (!token || *token == "}")
+	{
+		return {};
+	}
+	if (*token != "{")
+	{
+		return *getNextToken();
+	}
+
+	const auto start = static_cast<size_t>(token->data() - text_.data());
+	skipItem();
+	return text_.substr(start, position_ - start);
+}
+
+
+void Vic2::SaveTokenizer::skipItem()
+{
+	const auto hadEquals = peekToken() == "=";
+	skipEquals();
+
+	const auto token = peekToken();
+	if (!token || *token == "}")
+	{
+		return;
+	}
+	if (*token == "{")
+	{
+		skipToken(*token);
+		skipRestOfBlock();
+	}
+	else if (hadEquals)
+	{
+		skipToken(*token);
+	}
+}
+
+
+bool Vic2::SaveTokenizer::enterBlock()
+{
+	skipEquals();
+	if (const auto token = peekToken(); token == "{")
+	{
+		skipToken(*token);
+		return true;
+	}
+	return false;
+}
+
+
+void Vic2::SaveTokenizer::skipToken(const std::string_view token)
+{
+	position_ = static_cast<size_t>(token.data() - text_.data()) + token.size();
+}
+
+
+// Most of a save is skipped, so this scans for braces directly instead of tokenizing. Quoted strings and comments are
+// stepped over so braces inside them don't count.
+void Vic2::SaveTokenizer::skipRestOfBlock()
+{
+	int depth = 1;
+	while (depth > 0)
+	{
+		position_ = text_.find_first_of("{}\"#", position_);
+		if (position_ == std::string_view::npos)
+		{
+			position_ = text_.size();
+			return;
+		}
+
+		switch (text_[position_])
+		{
+			case '{':
+				++depth;
+				++position_;
+				break;
+			case '}':
+				--depth;
+				++position_;
+				break;
+			case '"':
+				skipQuotedString();
+				break;
+			default:
+				position_ = std::min(text_.find('\n', position_), text_.size());
+				break;
+		}
+	}
+}
+
+
+void Vic2::SaveTokenizer::skipQuotedString()
+{
+	++position_;
+	while (position_ < text_.size())
+	{
+		position_ = text_.find_first_of("\"\\", position_);
+		if (position_ == std::string_view::npos)
+		{
+			position_ = text_.size();
+			return;
+		}
+		if (text_[position_] == '"')
+		{
+			++position_;
+			return;
+		}
+		position_ += 2;
+	}
+	position_ = std::min(position_, text_.size());
+}
+
+
+void Vic2::SaveTokenizer::skipEquals()
+{
+	if (const auto token = peekToken(); token == "=")
+	{
+		skipToken(*token);
+	}
+}
+
+
+template <typename Number> Number Vic2::SaveTokenizer::toNumber(const std::string_view token)
+{
+	const auto unquoted = removeQuotes(token);
+	const auto* const textEnd = unquoted.data() + unquoted.size();
+	Number number = 0;
+	auto [end, error] = std::from_chars(unquoted.data(), textEnd, number);
+
+	// whole numbers are sometimes written with decimals, which are dropped as stoi did
+	if constexpr (std::is_integral_v<Number>)
+	{
+		if (error == std::errc() && end != textEnd && *end == '.')
+		{
+			end = std::find_if_not(end + 1, textEnd, [](const char character) {
+				return character >= '0' && character <= '9';
+			});
+		}
+	}
+
+	if (error != std::errc() || end != textEnd)
+	{
+		warnings_.push_back("Could not read a number from " + std::string(token));
+		return 0;
+	}
+	return number;
+}
+
+
+std::string_view Vic2::removeQuotes(const std::string_view token)
+{
+	if (token.size() >= 2 && token.front() == '"' && token.back() == '"')
+	{
+		return token.substr(1, token.size() - 2);
+	}
+	return token;
+}
+
+
+std::stringstream Vic2::makeItemStream(const std::string_view item)
+{
+	return std::stringstream("= " + std::string(item));
+}
@@ -0,0 +1,122 @@
+#ifndef VIC2_SAVE_TOKENIZER_H
+#define VIC2_SAVE_TOKENIZER_H
+
+
+
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+
+namespace Vic2
+{
+
+// Splits save text into the same tokens the commonItems parser sees: braces and equals signs are tokens of their own,
+// quoted strings keep their quotes, and comments are skipped. Tokens are views into the text, so nothing is copied
+// until a factory keeps a value.
+class SaveTokenizer
+{
+  public:
+	explicit SaveTokenizer(std::string_view text): text_(text) {}
+
+	[[nodiscard]] std::optional<std::string_view> getNextToken();
+	[[nodiscard]] std::optional<std::string_view> peekToken();
+
+	// The value readers skip the equals sign before the value
+	[[nodiscard]] std::string_view getString(); // without quotes
+	[[nodiscard]] int getInt();
+	[[nodiscard]] double getDouble();
+	[[nodiscard]] std::vector<int> getInts();
+	[[nodiscard]] std::vector<double> getDoubles();
+	[[nodiscard]] std::vector<std::string_view> getStrings(); // without quotes
+
+	// The raw text of the next value, including the braces if it's a block
+	[[nodiscard]] std::string_view getItem();
+
+	// Skips the value of an item if it has one
+	void skipItem();
+
+	// Values that should have been numbers but weren't, which are read as 0
+	[[nodiscard]] const std::vector<std::string>& getWarnings() const { return warnings_; }
+
+	// Calls handleItem(key) for each item in the block that is next, which must read or skip the item's value. Without
+	// braces, the items run until the end of the text or of the enclosing block.
+	template <typename ItemHandler> void parseBlock(ItemHandler&& handleItem);
+
+	// Calls handleAssignment(key, value) for each key=value pair in the block that is next
+	template <typename AssignmentHandler> void parseAssignments(AssignmentHandler&& handleAssignment);
+
+  private:
+	[[nodiscard]] bool enterBlock();
+	void skipToken(std::string_view token);
+	void skipRestOfBlock();
+	void skipQuotedString();
+	void skipEquals();
+	template <typename Number> [[nodiscard]] Number toNumber(std::string_view token);
+
+	std::string_view text_;
+	size_t position_ = 0;
+	std::vector<std::string> warnings_;
+};
+
+
+[[nodiscard]] std::string_view removeQuotes(std::string_view token);
+
+// Wraps an item so it can be handed to the stream-based factories
+[[nodiscard]] std::stringstream makeItemStream(std::string_view item);
+
+
+template <typename ItemHandler> void SaveTokenizer::parseBlock(ItemHandler&& handleItem)
+{
+	const auto braced = enterBlock();
+	while (const auto token = peekToken())
+	{
+		if (*token == "}")
+		{
+			if (braced)
+			{
+				skipToken(*token);
+			}
+			return;
+		}
+		skipToken(*token);
+		if (*token == "{")
+		{
+			skipRestOfBlock();
+			continue;
+		}
+		if (*token == "=")
+		{
+			continue;
+		}
+		handleItem(*token);
+	}
+}
+
+
+template <typename AssignmentHandler> void SaveTokenizer::parseAssignments(AssignmentHandler&& handleAssignment)
+{
+	parseBlock([this, &handleAssignment](const std::string_view key) {
+		skipEquals();
+		const auto value = peekToken();
+		if (!value || *value == "}")
+		{
+			return;
+		}
+		if (*value == "{")
+		{
+			skipItem();
+			return;
+		}
+		handleAssignment(key, *getNextToken());
+	});
+}
+
+} // namespace Vic2
+
+
+
+#endif // VIC2_SAVE_TOKENIZER_H
@@ -5,6 +5,20 @@
 
 
 
+namespace
+{
+
+const auto aristocratsType = Vic2::internPopName("aristocrats");
+const auto artisansType = Vic2::internPopName("artisans");
+const auto bureaucratsType = Vic2::internPopName("bureaucrats");
+const auto capitalistsType = Vic2::internPopName("capitalists");
+const auto clerksType = Vic2::internPopName("clerks");
+const auto craftsmenType = Vic2::internPopName("craftsmen");
+
+} // namespace
+
+
+
 void Vic2::State::determineEmployedWorkers()
 {
 	auto workers = countEmployedWorkers();
@@ -19,10 +33,10 @@ Vic2::workerStruct Vic2::State::countEmployedWorkers() const
 
 	for (const auto& province: provinces)
 	{
-		workers.craftsmen += static_cast<float>(province->getPopulation("craftsmen"));
-		workers.clerks += static_cast<float>(province->getPopulation("clerks"));
-		workers.artisans += static_cast<float>(province->getPopulation("artisans"));
-		workers.capitalists += static_cast<float>(province->getLiteracyWeightedPopulation("capitalists"));
+		workers.craftsmen += static_cast<float>(province->getPopulation(craftsmenType));
+		workers.clerks += static_cast<float>(province->getPopulation(clerksType));
+		workers.artisans += static_cast<float>(province->getPopulation(artisansType));
+		workers.capitalists += static_cast<float>(province->getLiteracyWeightedPopulation(capitalistsType));
 	}
 
 	return workers;
@@ -105,8 +119,8 @@ std::optional<int> Vic2::State::getUpperClassLocation() const
 {
 	for (const auto& province: provinces)
 	{
-		if ((province->getPopulation("aristocrats") > 0) || (province->getPopulation("bureaucrats") > 0) ||
-			 (province->getPopulation("capitalists") > 0))
+		if ((province->getPopulation(aristocratsType) > 0) || (province->getPopulation(bureaucratsType) > 0) ||
+			 (province->getPopulation(capitalistsType) > 0))
 		{
 			return province->getNumber();
 		}
@@ -1,5 +1,6 @@
 #include "StateDefinitionsFactory.h"
 #include "CommonRegexes.h"
+#include "LoadedResources.h"
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
 #include "ParserHelpers.h"
@@ -55,4 +56,15 @@ std::unique_ptr<Vic2::StateDefinitions> Vic2::StateDefinitions::Factory::getStat
 	}
 
 	return std::move(stateDefinitions);
-}
\ No newline at end of file
+}
+
+
+std::shared_ptr<const Vic2::StateDefinitions> Vic2::StateDefinitions::Factory::loadStateDefinitions(
+	 const Configuration& theConfiguration)
+{
+	static LoadedResources<StateDefinitions> loadedStateDefinitions;
+	return loadedStateDefinitions.get(makeResourceKey(theConfiguration.getVic2Path(), theConfiguration.getVic2Mods()),
+		 [&theConfiguration] {
+			 return Factory().getStateDefinitions(theConfiguration);
+		 });
+}
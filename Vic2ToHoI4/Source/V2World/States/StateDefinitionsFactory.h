@@ -5,6 +5,7 @@
 
 #include "Configuration.h"
 #include "StateDefinitions.h"
+#include <memory>
 
 
 
@@ -17,6 +18,10 @@ class StateDefinitions::Factory: commonItems::parser
 	Factory();
 	std::unique_ptr<StateDefinitions> getStateDefinitions(const Configuration& theConfiguration);
 
+	// reads the state definitions for a Vic2 install and mod list once per run
+	[[nodiscard]] static std::shared_ptr<const StateDefinitions> loadStateDefinitions(
+		 const Configuration& theConfiguration);
+
   private:
 	std::unique_ptr<StateDefinitions> stateDefinitions;
 };
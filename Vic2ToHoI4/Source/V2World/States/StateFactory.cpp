@@ -22,13 +22,14 @@ Vic2::State::Factory::Factory()
 
 std::unique_ptr<Vic2::State> Vic2::State::Factory::getState(std::istream& theStream,
 	 const std::string& ownerTag,
-	 const StateDefinitions& theStateDefinitions)
+	 const StateDefinitions& theStateDefinitions,
+	 std::vector<std::string>& warnings)
 {
 	state = std::make_unique<State>();
 
 	state->owner = ownerTag;
 	parseStream(theStream);
-	setID(theStateDefinitions);
+	setID(theStateDefinitions, warnings);
 	determineIfPartialState(theStateDefinitions);
 	setCapital(theStateDefinitions);
 
@@ -47,7 +48,12 @@ std::unique_ptr<Vic2::State> Vic2::State::Factory::getUnownedState(
 		state->provinceNumbers.insert(provinceNum);
 		state->provinces.push_back(province);
 	}
-	setID(theStateDefinitions);
+	std::vector<std::string> warnings;
+	setID(theStateDefinitions, warnings);
+	for (const auto& warning: warnings)
+	{
+		Log(LogLevel::Warning) << warning;
+	}
 	determineIfPartialState(theStateDefinitions);
 	setCapital(theStateDefinitions);
 
@@ -55,7 +61,8 @@ std::unique_ptr<Vic2::State> Vic2::State::Factory::getUnownedState(
 }
 
 
-void Vic2::State::Factory::setID(const StateDefinitions& theStateDefinitions) const
+void Vic2::State::Factory::setID(const StateDefinitions& theStateDefinitions,
+	 std::vector<std::string>& warnings) const
 {
 	const auto& provinceNumbers = state->provinceNumbers;
 	if (provinceNumbers.empty())
@@ -69,7 +76,8 @@ void Vic2::State::Factory::setID(const StateDefinitions& theStateDefinitions) co
 	}
 	else
 	{
-		Log(LogLevel::Warning) << "Could not find the state for Vic2 province " << *provinceNumbers.begin() << ".";
+		warnings.push_back(
+			 "Could not find the state for Vic2 province " + std::to_string(*provinceNumbers.begin()) + ".");
 	}
 }
 
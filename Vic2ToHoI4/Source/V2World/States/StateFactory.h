@@ -8,6 +8,8 @@
 #include "State.h"
 #include "StateDefinitions.h"
 #include <memory>
+#include <string>
+#include <vector>
 
 
 
@@ -20,12 +22,13 @@ class State::Factory: commonItems::parser
 	Factory();
 	std::unique_ptr<State> getState(std::istream& theStream,
 		 const std::string& ownerTag,
-		 const StateDefinitions& theStateDefinitions);
+		 const StateDefinitions& theStateDefinitions,
+		 std::vector<std::string>& warnings);
 	std::unique_ptr<State> getUnownedState(const std::unordered_map<int, std::shared_ptr<Province>>& theProvinces,
 		 const StateDefinitions& theStateDefinitions);
 
   private:
-	void setID(const StateDefinitions& theStateDefinitions) const;
+	void setID(const StateDefinitions& theStateDefinitions, std::vector<std::string>& warnings) const;
 	void setCapital(const StateDefinitions& theStateDefinitions) const;
 	void determineIfPartialState(const StateDefinitions& theStateDefinitions) const;
 
@@ -1,4 +1,5 @@
 #include "InventionsFactory.h"
+#include "LoadedResources.h"
 #include "OSCompatibilityLayer.h"
 #include "ParserHelpers.h"
 
@@ -26,6 +27,18 @@ std::unique_ptr<Vic2::Inventions> Vic2::Inventions::Factory::loadInventions(cons
 }
 
 
+std::shared_ptr<const Vic2::Inventions> Vic2::Inventions::Factory::loadSharedInventions(
+	 const Configuration& theConfiguration)
+{
+	static LoadedResources<Inventions> loadedInventions;
+	return loadedInventions.get(makeResourceKey(theConfiguration.getVic2Path(), theConfiguration.getVic2Mods()),
+		 [&theConfiguration] {
+			 return Factory().loadInventions(theConfiguration);
+		 });
+}
+
+
+
 std::vector<std::string> Vic2::Inventions::Factory::getInventionFiles(const Configuration& theConfiguration) const
 {
 	const auto techFiles = getTechFilesAndPaths(theConfiguration);
@@ -21,6 +21,9 @@ class Inventions::Factory: commonItems::parser
 	Factory();
 	std::unique_ptr<Inventions> loadInventions(const Configuration& theConfiguration);
 
+	// reads the inventions for a Vic2 install and mod list once per run
+	[[nodiscard]] static std::shared_ptr<const Inventions> loadSharedInventions(const Configuration& theConfiguration);
+
   private:
 	[[nodiscard]] std::vector<std::string> getInventionFiles(const Configuration& theConfiguration) const;
 	[[nodiscard]] std::map<std::string, std::string> getTechFilesAndPaths(const Configuration& theConfiguration) const;
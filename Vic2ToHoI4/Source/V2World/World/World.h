@@ -46,7 +46,7 @@ class World
 	std::map<std::string, Country> countries;
 	std::unique_ptr<Diplomacy> diplomacy;
 	std::vector<std::string> greatPowers;
-	std::unique_ptr<StateDefinitions> theStateDefinitions;
+	std::shared_ptr<const StateDefinitions> theStateDefinitions;
 	std::unique_ptr<Localisations> theLocalisations;
 	std::unique_ptr<date> theDate;
 	std::unique_ptr<Maps::MapData> mapData_;
@@ -1,27 +1,70 @@
 #include "WorldFactory.h"
-#include "CommonRegexes.h"
 #include "Log.h"
 #include "Mappers/MergeRules/MergeRules.h"
 #include "Mappers/MergeRules/MergeRulesFactory.h"
-#include "ParserHelpers.h"
 #include "V2World/Countries/CommonCountriesDataFactory.h"
 #include "V2World/Culture/CultureGroupsFactory.h"
 #include "V2World/Issues/IssuesFactory.h"
 #include "V2World/Localisations/LocalisationsFactory.h"
+#include "V2World/Military/Leaders/TraitsFactory.h"
 #include "V2World/Map/Vic2ProvinceDefinitionImporter.h"
 #include "V2World/Pops/PopFactory.h"
+#include "V2World/Save/SaveFile.h"
+#include "V2World/Save/SaveKeys.h"
 #include "V2World/States/StateDefinitionsFactory.h"
 #include "V2World/States/StateLanguageCategoriesFactory.h"
+#include "V2World/Technology/InventionsFactory.h"
+#include <algorithm>
 #include <ranges>
+#include <thread>
+
+
+
+namespace
+{
+
+// Worker N imports every Nth item. Each worker only writes its own items' results and warnings, so they come back in
+// item order, and the warnings are logged in that order once every item is imported.
+template <typename Result, typename Item, typename Importer>
+std::vector<Result> importInParallel(const std::vector<Item>& items, const size_t numWorkers, const Importer& importItem)
+{
+	std::vector<Result> results(items.size());
+	std::vector<std::vector<std::string>> warnings(items.size());
+	std::vector<std::future<void>> workers;
+	for (size_t worker = 0; worker < numWorkers; ++worker)
+	{
+		workers.push_back(
+			 std::async(std::launch::async, [&items, &results, &warnings, &importItem, worker, numWorkers] {
+				 for (auto i = worker; i < items.size(); i += numWorkers)
+				 {
+					 results[i] = importItem(worker, items[i], warnings[i]);
+				 }
+			 }));
+	}
+	for (auto& worker: workers)
+	{
+		worker.get();
+	}
+
+	for (const auto& itemWarnings: warnings)
+	{
+		for (const auto& warning: itemWarnings)
+		{
+			Log(LogLevel::Warning) << warning;
+		}
+	}
+
+	return results;
+}
+
+} // namespace
 
 
 
 Vic2::World::Factory::Factory(const Configuration& theConfiguration):
 	 theCultureGroups(CultureGroups::Factory().getCultureGroups(theConfiguration)),
 	 theIssues(Issues::Factory().getIssues(theConfiguration.getVic2Path())),
-	 provinceFactory(std::make_unique<Province::Factory>(std::make_unique<PopFactory>(*theIssues))),
-	 theStateDefinitions(StateDefinitions::Factory().getStateDefinitions(theConfiguration)),
-	 countryFactory(std::make_unique<Country::Factory>(theConfiguration, *theStateDefinitions, theCultureGroups)),
+	 theStateDefinitions(StateDefinitions::Factory::loadStateDefinitions(theConfiguration)),
 	 stateLanguageCategories(StateLanguageCategories::Factory().getCategories()),
 	 diplomacyFactory(std::make_unique<Diplomacy::Factory>())
 {
@@ -29,50 +72,24 @@ Vic2::World::Factory::Factory(const Configuration& theConfiguration):
 	commonCountriesData = commonCountriesData_;
 	allParties = allParties_;
 	countriesData = CountriesData::Factory().importCountriesData(theConfiguration);
+	percentOfCommanders = theConfiguration.getPercentOfCommanders();
 
-	registerKeyword("date", [this](std::istream& theStream) {
-		world->theDate = std::make_unique<date>(date(commonItems::singleString{theStream}.getString()));
-	});
-
-	registerKeyword("great_nations", [this](std::istream& theStream) {
-		greatPowerIndexes = commonItems::intList{theStream}.getInts();
-	});
-	registerRegex(R"(\d+)", [this](const std::string& provinceID, std::istream& theStream) {
-		const auto provinceNum = std::stoi(provinceID); // the regex ensures the ID is always a valid number
-		world->provinces[provinceNum] = provinceFactory->getProvince(provinceNum, theStream);
-	});
-	registerRegex("[A-Z][A-Z0-9]{2}", [this, theConfiguration](const std::string& countryTag, std::istream& theStream) {
-		if (const auto commonCountryData = commonCountriesData.find(countryTag);
-			 commonCountryData != commonCountriesData.end())
-		{
-			world->countries.emplace(countryTag,
-				 *countryFactory->createCountry(countryTag,
-					  theStream,
-					  commonCountryData->second,
-					  allParties,
-					  *stateLanguageCategories,
-					  theConfiguration.getPercentOfCommanders(),
-					  countriesData->getCountryData(countryTag)));
-			tagsInOrder.push_back(countryTag);
-		}
-		else
-		{
-			Log(LogLevel::Warning) << "Invalid tag " << countryTag;
-			commonItems::ignoreItem(countryTag, theStream);
-		}
-	});
-	registerKeyword("diplomacy", [this](std::istream& theStream) {
-		world->diplomacy = diplomacyFactory->getDiplomacy(theStream);
-	});
-	registerKeyword("active_war", [this](std::istream& theStream) {
-		wars.push_back(warFactory.getWar(theStream));
-	});
-	registerRegex(commonItems::catchallRegex, commonItems::ignoreItem);
+	// the province and country factories keep what they're building in members, so each save worker gets its own
+	const auto inventions = Inventions::Factory::loadSharedInventions(theConfiguration);
+	const auto traits = Traits::Factory().loadTraits(theConfiguration.getVic2Path());
+	const auto numWorkers = std::max(std::thread::hardware_concurrency(), 1U);
+	for (unsigned int worker = 0; worker < numWorkers; ++worker)
+	{
+		provinceFactories.push_back(std::make_unique<Province::Factory>(std::make_unique<PopFactory>(*theIssues)));
+		countryFactories.push_back(
+			 std::make_unique<Country::Factory>(inventions, *traits, *theStateDefinitions, theCultureGroups));
+	}
 }
 
 
 std::unique_ptr<Vic2::World> Vic2::World::Factory::importWorld(const Configuration& theConfiguration,
-	 const Mappers::ProvinceMapper& provinceMapper)
+	 const Mappers::ProvinceMapper& provinceMapper,
+	 std::future<std::unique_ptr<Maps::MapData>> mapData)
 {
 	Log(LogLevel::Progress) << "15%";
 	Log(LogLevel::Info) << "*** Importing V2 save ***";
@@ -81,11 +98,12 @@ std::unique_ptr<Vic2::World> Vic2::World::Factory::importWorld(const Configurati
 	tagsInOrder.clear();
 	tagsInOrder.emplace_back(""); // REB (first country is index 1)
 	wars.clear();
+	mergeRules = Mappers::MergeRules::Factory().importMergeRules();
 
 	world = std::make_unique<World>();
-	world->theStateDefinitions = StateDefinitions::Factory().getStateDefinitions(theConfiguration);
+	world->theStateDefinitions = StateDefinitions::Factory::loadStateDefinitions(theConfiguration);
 	world->theLocalisations = Localisations::Factory().importLocalisations(theConfiguration);
-	parseFile(theConfiguration.getInputFile());
+	importSave(theConfiguration.getInputFile());
 	if (!world->diplomacy)
 	{
 		Log(LogLevel::Warning) << "Vic2 save had no diplomacy section!";
@@ -107,12 +125,173 @@ std::unique_ptr<Vic2::World> Vic2::World::Factory::importWorld(const Configurati
 	consolidateConquerStrategies();
 	moveArmiesHome();
 	removeBattles();
-	importMapData(theConfiguration.getVic2Path());
+	if (mapData.valid())
+	{
+		world->mapData_ = mapData.get();
+	}
+	else
+	{
+		world->mapData_ = importMapData(theConfiguration.getVic2Path());
+	}
 
 	return std::move(world);
 }
 
 
+void Vic2::World::Factory::importSave(const std::string& saveFile)
+{
+	const SaveFile save(saveFile);
+	auto contents = save.getContents();
+	if (contents.starts_with("\xEF\xBB\xBF"))
+	{
+		contents.remove_prefix(3);
+	}
+
+	// the first pass reads the small items and finds where each province and country is
+	SaveItems saveItems;
+	SaveTokenizer tokenizer(contents);
+	tokenizer.parseBlock([this, &tokenizer, &saveItems](const std::string_view key) {
+		importSaveItem(key, tokenizer, saveItems);
+	});
+	for (const auto& warning: tokenizer.getWarnings())
+	{
+		Log(LogLevel::Warning) << warning;
+	}
+
+	// the second pass builds the provinces, then the countries that can outlast merging and empty nation removal
+	importProvinces(saveItems);
+	importCountries(saveItems);
+}
+
+
+void Vic2::World::Factory::importSaveItem(const std::string_view key, SaveTokenizer& tokenizer, SaveItems& saveItems)
+{
+	if (key == "date")
+	{
+		world->theDate = std::make_unique<date>(date(std::string(tokenizer.getString())));
+	}
+	else if (key == "great_nations")
+	{
+		greatPowerIndexes = tokenizer.getInts();
+	}
+	else if (key == "diplomacy")
+	{
+		auto diplomacyStream = makeItemStream(tokenizer.getItem());
+		world->diplomacy = diplomacyFactory->getDiplomacy(diplomacyStream);
+	}
+	else if (key == "active_war")
+	{
+		auto warStream = makeItemStream(tokenizer.getItem());
+		wars.push_back(warFactory.getWar(warStream));
+	}
+	else if (isProvinceNumber(key))
+	{
+		const auto provinceNum = std::stoi(std::string(key)); // isProvinceNumber ensures the ID is always a valid number
+		saveItems.provinces.emplace_back(provinceNum, tokenizer.getItem());
+	}
+	else if (isCountryTag(key))
+	{
+		std::string countryTag(key);
+		if (commonCountriesData.contains(countryTag))
+		{
+			tagsInOrder.push_back(countryTag);
+			saveItems.countries.emplace_back(std::move(countryTag), tokenizer.getItem());
+		}
+		else
+		{
+			Log(LogLevel::Warning) << "Invalid tag " << countryTag;
+			tokenizer.skipItem();
+		}
+	}
+	else
+	{
+		tokenizer.skipItem();
+	}
+}
+
+
+void Vic2::World::Factory::importProvinces(const SaveItems& saveItems)
+{
+	auto provinces = importInParallel<std::unique_ptr<Province>>(saveItems.provinces,
+		 provinceFactories.size(),
+		 [this](const size_t worker,
+			  const std::pair<int, std::string_view>& provinceItem,
+			  std::vector<std::string>& warnings) {
+			 SaveTokenizer tokenizer(provinceItem.second);
+			 auto province = provinceFactories[worker]->getProvince(provinceItem.first, tokenizer, warnings);
+			 warnings.insert(warnings.end(), tokenizer.getWarnings().begin(), tokenizer.getWarnings().end());
+			 return province;
+		 });
+
+	for (size_t i = 0; i < saveItems.provinces.size(); ++i)
+	{
+		world->provinces[saveItems.provinces[i].first] = std::move(provinces[i]);
+	}
+}
+
+
+void Vic2::World::Factory::importCountries(const SaveItems& saveItems)
+{
+	// countries that would only be thrown away by removeEmptyNations aren't parsed at all
+	const auto tagsThatCanSurvive = findTagsThatCanSurvive();
+	std::vector<std::pair<std::string, std::string_view>> countryItems;
+	for (const auto& countryItem: saveItems.countries)
+	{
+		if (tagsThatCanSurvive.contains(countryItem.first))
+		{
+			countryItems.push_back(countryItem);
+		}
+	}
+
+	auto countries = importInParallel<std::unique_ptr<Country>>(countryItems,
+		 countryFactories.size(),
+		 [this](const size_t worker,
+			  const std::pair<std::string, std::string_view>& countryItem,
+			  std::vector<std::string>& warnings) {
+			 const auto& [countryTag, countryText] = countryItem;
+			 SaveTokenizer tokenizer(countryText);
+			 auto country = countryFactories[worker]->createCountry(countryTag,
+				  tokenizer,
+				  commonCountriesData.at(countryTag),
+				  allParties,
+				  *stateLanguageCategories,
+				  percentOfCommanders,
+				  countriesData->getCountryData(countryTag),
+				  warnings);
+			 warnings.insert(warnings.end(), tokenizer.getWarnings().begin(), tokenizer.getWarnings().end());
+			 return country;
+		 });
+
+	for (size_t i = 0; i < countryItems.size(); ++i)
+	{
+		world->countries.emplace(countryItems[i].first, std::move(*countries[i]));
+	}
+}
+
+
+// A country only ends up with provinces or cores if a province names it as owner or core, or if it's merged with a
+// country that does. Merged countries are kept either way, since a master takes its slaves' armies and technologies.
+std::set<std::string> Vic2::World::Factory::findTagsThatCanSurvive() const
+{
+	std::set<std::string> tags;
+	for (const auto& province: world->provinces | std::views::values)
+	{
+		if (!province->getOwner().empty())
+		{
+			tags.insert(province->getOwner());
+		}
+		tags.insert(province->getCores().begin(), province->getCores().end());
+	}
+	for (const auto& [master, slaves]: mergeRules->getRules())
+	{
+		tags.insert(master);
+		tags.insert(slaves.begin(), slaves.end());
+	}
+
+	return tags;
+}
+
+
 void Vic2::World::Factory::setGreatPowerStatus()
 {
 	Log(LogLevel::Info) << "\tSetting Great Power statuses";
@@ -325,8 +504,7 @@ void Vic2::World::Factory::addWarsToCountries(const std::vector<War>& wars)
 void Vic2::World::Factory::overallMergeNations(bool debug)
 {
 	Log(LogLevel::Info) << "\tMerging nations";
-	const auto theMergeRules = Mappers::MergeRules::Factory().importMergeRules();
-	for (const auto& [master, slaves]: theMergeRules->getRules())
+	for (const auto& [master, slaves]: mergeRules->getRules())
 	{
 		mergeNations(master, slaves, debug);
 	}
@@ -523,9 +701,10 @@ bool Vic2::World::Factory::armiesHaveDifferentOwners(const std::vector<Army*>& a
 }
 
 
-void Vic2::World::Factory::importMapData(const std::string& path)
+// The map data only uses the province colors from the definitions, which don't need the provinces from the save
+std::unique_ptr<Maps::MapData> Vic2::World::Factory::importMapData(const std::string& vic2Path)
 {
 	Log(LogLevel::Info) << "\tImporting map data";
-	const auto& provinceDefinitions = importProvinceDefinitions(path, world->provinces);
-	world->mapData_ = std::make_unique<Maps::MapData>(provinceDefinitions, path);
+	const auto provinceDefinitions = importProvinceDefinitions(vic2Path, {});
+	return std::make_unique<Maps::MapData>(provinceDefinitions, vic2Path);
 }
\ No newline at end of file
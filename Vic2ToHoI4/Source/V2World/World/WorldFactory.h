@@ -4,31 +4,55 @@
 
 
 #include "Configuration.h"
+#include "Mappers/MergeRules/MergeRules.h"
 #include "Mappers/Provinces/ProvinceMapper.h"
-#include "Parser.h"
+#include "Maps/MapData.h"
 #include "V2World/Countries/CountryFactory.h"
 #include "V2World/Culture/CultureGroups.h"
 #include "V2World/Diplomacy/DiplomacyFactory.h"
 #include "V2World/EU4ToVic2Data/CountriesDataFactory.h"
 #include "V2World/Issues/Issues.h"
 #include "V2World/Provinces/ProvinceFactory.h"
+#include "V2World/Save/SaveTokenizer.h"
 #include "V2World/Wars/WarFactory.h"
 #include "World.h"
+#include <future>
 #include <memory>
+#include <set>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 
 
 namespace Vic2
 {
 
-class World::Factory: commonItems::parser
+class World::Factory
 {
   public:
 	explicit Factory(const Configuration& theConfiguration);
+	// the map data can be passed in if it's already being loaded elsewhere, otherwise it's loaded after the save
 	std::unique_ptr<World> importWorld(const Configuration& theConfiguration,
-		 const Mappers::ProvinceMapper& provinceMapper);
+		 const Mappers::ProvinceMapper& provinceMapper,
+		 std::future<std::unique_ptr<Maps::MapData>> mapData = {});
+
+	// the map doesn't depend on the save, so this can run before or alongside importWorld
+	[[nodiscard]] static std::unique_ptr<Maps::MapData> importMapData(const std::string& vic2Path);
 
   private:
+	// the province and country items in a save, in save order, as views into the save text so they can be parsed later
+	struct SaveItems
+	{
+		std::vector<std::pair<int, std::string_view>> provinces;
+		std::vector<std::pair<std::string, std::string_view>> countries;
+	};
+
+	void importSave(const std::string& saveFile);
+	void importSaveItem(std::string_view key, SaveTokenizer& tokenizer, SaveItems& saveItems);
+	void importProvinces(const SaveItems& saveItems);
+	void importCountries(const SaveItems& saveItems);
+	[[nodiscard]] std::set<std::string> findTagsThatCanSurvive() const;
 	void setLocalisations(Localisations& vic2Localisations);
 	void setGreatPowerStatus();
 	void setProvinceOwners();
@@ -46,7 +70,6 @@ class World::Factory: commonItems::parser
 	void consolidateConquerStrategies();
 	void moveArmiesHome();
 	void removeBattles();
-	void importMapData(const std::string& path);
 	[[nodiscard]] std::map<int, std::vector<Army*>> determineArmyLocations() const;
 	[[nodiscard]] static bool armiesHaveDifferentOwners(const std::vector<Army*>& armies);
 
@@ -55,17 +78,19 @@ class World::Factory: commonItems::parser
 	std::vector<int> greatPowerIndexes;
 	std::vector<std::string> tagsInOrder;
 	std::vector<War> wars;
+	std::unique_ptr<Mappers::MergeRules> mergeRules;
 
 	std::shared_ptr<CultureGroups> theCultureGroups;
 	std::unique_ptr<Issues> theIssues;
-	std::unique_ptr<Province::Factory> provinceFactory;
+	std::vector<std::unique_ptr<Province::Factory>> provinceFactories;
 	War::Factory warFactory;
-	std::unique_ptr<StateDefinitions> theStateDefinitions;
-	std::unique_ptr<Country::Factory> countryFactory;
+	std::shared_ptr<const StateDefinitions> theStateDefinitions;
+	std::vector<std::unique_ptr<Country::Factory>> countryFactories;
 	std::unique_ptr<StateLanguageCategories> stateLanguageCategories;
 	std::unique_ptr<Diplomacy::Factory> diplomacyFactory;
 	std::map<std::string, CommonCountryData> commonCountriesData;
 	std::vector<Party> allParties;
+	float percentOfCommanders = 0.0F;
 
 	std::unique_ptr<CountriesData> countriesData;
 };
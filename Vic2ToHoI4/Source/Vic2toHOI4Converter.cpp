@@ -7,6 +7,7 @@
 #include "OutHoi4/OutMod.h"
 #include "V2World/World/World.h"
 #include "V2World/World/WorldFactory.h"
+#include <future>
 
 void ConvertV2ToHoI4(const commonItems::ConverterVersion& converterVersion)
 {
@@ -16,8 +17,16 @@ void ConvertV2ToHoI4(const commonItems::ConverterVersion& converterVersion)
 	const auto provinceMapper =
 		 Mappers::ProvinceMapper::Factory(*theConfiguration).importProvinceMapper(*theConfiguration);
 
-	const auto sourceWorld = Vic2::World::Factory(*theConfiguration).importWorld(*theConfiguration, *provinceMapper);
-	const HoI4::World destWorld(*sourceWorld, *provinceMapper, *theConfiguration);
+	// the maps, default states, strategic regions and HoI4 localisations don't depend on the save, so load them while
+	// the save is being parsed
+	auto saveIndependentData =
+		 std::async(std::launch::async, HoI4::importSaveIndependentData, std::cref(*theConfiguration));
+	auto vic2MapData =
+		 std::async(std::launch::async, Vic2::World::Factory::importMapData, theConfiguration->getVic2Path());
+
+	const auto sourceWorld = Vic2::World::Factory(*theConfiguration)
+										  .importWorld(*theConfiguration, *provinceMapper, std::move(vic2MapData));
+	const HoI4::World destWorld(*sourceWorld, *provinceMapper, *theConfiguration, saveIndependentData.get());
 
 	output(destWorld,
 		 theConfiguration->getOutputName(),
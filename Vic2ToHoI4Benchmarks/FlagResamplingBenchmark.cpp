@@ -0,0 +1,156 @@
+// Times resizing Vic2 flags to the three HoI4 flag sizes, one size at a time as the converter used to and in a single
+// pass with the flag resampler.
+// Usage: FlagResamplingBenchmark <Vic2 flags folder> [iterations]
+#include "OutHoi4/Flags/FlagResampler.h"
+#include "targa.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+
+namespace
+{
+
+struct Flag
+{
+	std::vector<uint8_t> data;
+	unsigned int width;
+	unsigned int height;
+	unsigned int bytesPerPixel;
+};
+
+
+const std::vector<HoI4::FlagSize> nearestSizes{{82, 52}, {41, 26}, {10, 7}};
+const std::vector<HoI4::FlagSize> boxSmallSizes{{82, 52}, {41, 26}, {10, 7, HoI4::ResampleFilter::Box}};
+
+
+std::vector<Flag> readFlags(const std::string& folder)
+{
+	std::vector<Flag> flags;
+	for (const auto& entry: std::filesystem::directory_iterator(folder))
+	{
+		if (entry.path().extension() != ".tga")
+		{
+			continue;
+		}
+
+		tga_image image;
+		if (tga_read(&image, entry.path().string().c_str()) != TGA_NOERR)
+		{
+			continue;
+		}
+		if (image.pixel_depth == 24 || image.pixel_depth == 32)
+		{
+			const auto bytesPerPixel = image.pixel_depth / 8U;
+			flags.push_back({std::vector<uint8_t>(image.image_data,
+										  image.image_data + image.width * image.height * bytesPerPixel),
+				 image.width,
+				 image.height,
+				 bytesPerPixel});
+		}
+		tga_free_buffers(&image);
+	}
+	return flags;
+}
+
+
+// the sampling the converter did before the resampler: one pass over the source per size, in floating point
+std::vector<uint8_t> resampleOneSize(const Flag& flag, const unsigned int sizeX, const unsigned int sizeY)
+{
+	std::vector<uint8_t> image(sizeX * sizeY * 4);
+	for (unsigned int y = 0; y < sizeY; y++)
+	{
+		for (unsigned int x = 0; x < sizeX; x++)
+		{
+			const auto sourceY = static_cast<int>(1.0 * y / sizeY * flag.height);
+			const auto sourceX = static_cast<int>(1.0 * x / sizeX * flag.width);
+			const auto sourceIndex = (sourceY * flag.width + sourceX) * flag.bytesPerPixel;
+			const auto destIndex = (y * sizeX + x) * 4;
+
+			image[destIndex + 0] = flag.data[sourceIndex + 0];
+			image[destIndex + 1] = flag.data[sourceIndex + 1];
+			image[destIndex + 2] = flag.data[sourceIndex + 2];
+			image[destIndex + 3] = 0xFF;
+		}
+	}
+	return image;
+}
+
+
+template <typename Resampler> double timeResampling(const std::vector<Flag>& flags, int iterations, Resampler resample)
+{
+	size_t totalSize = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (int iteration = 0; iteration < iterations; ++iteration)
+	{
+		for (const auto& flag: flags)
+		{
+			for (const auto& image: resample(flag))
+			{
+				totalSize += image.size();
+			}
+		}
+	}
+	const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+	// using the output keeps the resizing from being optimized away
+	if (totalSize == 0)
+	{
+		std::cout << "No flags were resized\n";
+	}
+	return elapsed.count() / iterations;
+}
+
+
+std::vector<std::vector<uint8_t>> resampleEachSize(const Flag& flag)
+{
+	std::vector<std::vector<uint8_t>> images;
+	for (const auto& size: nearestSizes)
+	{
+		images.push_back(resampleOneSize(flag, size.width, size.height));
+	}
+	return images;
+}
+
+} // namespace
+
+
+
+int main(const int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		std::cout << "Usage: " << argv[0] << " <Vic2 flags folder> [iterations]\n";
+		return 1;
+	}
+	const auto iterations = argc > 2 ? std::max(std::stoi(argv[2]), 1) : 10;
+
+	const auto flags = readFlags(argv[1]);
+	int mismatches = 0;
+	for (const auto& flag: flags)
+	{
+		if (resampleEachSize(flag) !=
+			 HoI4::resampleFlag(flag.data.data(), flag.width, flag.height, flag.bytesPerPixel, nearestSizes))
+		{
+			++mismatches;
+		}
+	}
+	std::cout << flags.size() << " flags, " << mismatches << " resized differently\n";
+
+	const auto eachSizeTime = timeResampling(flags, iterations, resampleEachSize);
+	const auto singlePassTime = timeResampling(flags, iterations, [](const Flag& flag) {
+		return HoI4::resampleFlag(flag.data.data(), flag.width, flag.height, flag.bytesPerPixel, nearestSizes);
+	});
+	const auto boxSmallTime = timeResampling(flags, iterations, [](const Flag& flag) {
+		return HoI4::resampleFlag(flag.data.data(), flag.width, flag.height, flag.bytesPerPixel, boxSmallSizes);
+	});
+	std::cout << "each size:              " << eachSizeTime << " ms per pass\n";
+	std::cout << "single pass:            " << singlePassTime << " ms per pass\n";
+	std::cout << "single pass, box small: " << boxSmallTime << " ms per pass\n";
+
+	return 0;
+}
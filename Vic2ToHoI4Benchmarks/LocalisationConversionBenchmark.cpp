@@ -0,0 +1,149 @@
+// Times converting Vic2 localisations to UTF-8 with commonItems and with the converter's own tables.
+// Usage: LocalisationConversionBenchmark <Vic2 localisation folder> [iterations]
+#include "OSCompatibilityLayer.h"
+#include "V2World/Localisations/Win125xConverter.h"
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+
+namespace
+{
+
+// the encodings of the language columns in a Vic2 localisation line, after the key
+constexpr std::array columnEncodings{Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1250,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1250,
+	 Vic2::Encoding::Win1250,
+	 Vic2::Encoding::Win1250,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1252,
+	 Vic2::Encoding::Win1251,
+	 Vic2::Encoding::Win1252};
+
+
+struct Field
+{
+	std::string text;
+	Vic2::Encoding encoding;
+};
+
+
+std::vector<Field> readFields(const std::string& folder)
+{
+	std::vector<Field> fields;
+	for (const auto& entry: std::filesystem::directory_iterator(folder))
+	{
+		std::ifstream file(entry.path());
+		const std::string text{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+		std::string_view rest = text;
+		while (!rest.empty())
+		{
+			const auto lineEnd = std::min(rest.find('\n'), rest.size());
+			auto line = rest.substr(0, lineEnd);
+			rest.remove_prefix(std::min(lineEnd + 1, rest.size()));
+			if (line.starts_with('#'))
+			{
+				continue;
+			}
+
+			line.remove_prefix(std::min(line.find(';'), line.size()));
+			for (const auto encoding: columnEncodings)
+			{
+				if (line.empty())
+				{
+					break;
+				}
+				line.remove_prefix(1);
+				const auto columnEnd = std::min(line.find(';'), line.size());
+				fields.push_back({std::string(line.substr(0, columnEnd)), encoding});
+				line.remove_prefix(columnEnd);
+			}
+		}
+	}
+	return fields;
+}
+
+
+std::string convertWithCommonItems(const Field& field)
+{
+	switch (field.encoding)
+	{
+		case Vic2::Encoding::Win1250:
+			return commonItems::convertWin1250ToUTF8(field.text);
+		case Vic2::Encoding::Win1251:
+			return commonItems::convertWin1251ToUTF8(field.text);
+		default:
+			return commonItems::convertWin1252ToUTF8(field.text);
+	}
+}
+
+
+template <typename Converter> double timeConversion(const std::vector<Field>& fields, int iterations, Converter convert)
+{
+	size_t totalSize = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (int iteration = 0; iteration < iterations; ++iteration)
+	{
+		for (const auto& field: fields)
+		{
+			totalSize += convert(field).size();
+		}
+	}
+	const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+	// using the output keeps the conversions from being optimized away
+	if (totalSize == 0)
+	{
+		std::cout << "No text was converted\n";
+	}
+	return elapsed.count() / iterations;
+}
+
+} // namespace
+
+
+
+int main(const int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		std::cout << "Usage: " << argv[0] << " <Vic2 localisation folder> [iterations]\n";
+		return 1;
+	}
+	const auto iterations = argc > 2 ? std::max(std::stoi(argv[2]), 1) : 10;
+
+	const auto fields = readFields(argv[1]);
+	size_t bytes = 0;
+	int mismatches = 0;
+	for (const auto& field: fields)
+	{
+		bytes += field.text.size();
+		if (convertWithCommonItems(field) != Vic2::convertWin125xToUtf8(field.text, field.encoding))
+		{
+			++mismatches;
+		}
+	}
+	std::cout << fields.size() << " fields, " << bytes << " bytes, " << mismatches << " conversions differ\n";
+
+	const auto commonItemsTime = timeConversion(fields, iterations, convertWithCommonItems);
+	const auto tableTime = timeConversion(fields, iterations, [](const Field& field) {
+		return Vic2::convertWin125xToUtf8(field.text, field.encoding);
+	});
+	std::cout << "commonItems: " << commonItemsTime << " ms per pass\n";
+	std::cout << "tables:      " << tableTime << " ms per pass\n";
+
+	return 0;
+}
@@ -127,7 +127,8 @@ TEST(HoI4World_Military_HoI4ArmyTests, LeftoverRegimentsBecomeEquipment)
 		 "\t\t}\n"
 		 "\t}");
 	Vic2::Army::Factory armyFactory;
-	auto Vic2Army = *armyFactory.getArmy("", armyInput);
+	std::vector<std::string> warnings;
+	auto Vic2Army = *armyFactory.getArmy("", armyInput, warnings);
 	Vic2Armies.push_back(Vic2Army);
 	theArmy.addSourceArmies(Vic2Armies);
 
@@ -225,7 +226,8 @@ TEST(HoI4World_Military_HoI4ArmyTests, SufficientDivisionsConvert)
 		 "\t\t}\n"
 		 "\t}");
 	Vic2::Army::Factory armyFactory;
-	auto Vic2Army = *armyFactory.getArmy("", armyInput);
+	std::vector<std::string> warnings;
+	auto Vic2Army = *armyFactory.getArmy("", armyInput, warnings);
 	Vic2Armies.push_back(Vic2Army);
 	theArmy.addSourceArmies(Vic2Armies);
 
@@ -310,7 +312,8 @@ TEST(HoI4World_Military_HoI4ArmyTests, ExperienceConverts)
 		 "\t\t}\n"
 		 "\t}");
 	Vic2::Army::Factory armyFactory;
-	auto Vic2Army = *armyFactory.getArmy("", armyInput);
+	std::vector<std::string> warnings;
+	auto Vic2Army = *armyFactory.getArmy("", armyInput, warnings);
 	Vic2Armies.push_back(Vic2Army);
 	theArmy.addSourceArmies(Vic2Armies);
 
@@ -396,7 +399,8 @@ TEST(HoI4World_Military_HoI4ArmyTests, StrengthConverts)
 		 "\t\t}\n"
 		 "\t}");
 	Vic2::Army::Factory armyFactory;
-	auto Vic2Army = *armyFactory.getArmy("", armyInput);
+	std::vector<std::string> warnings;
+	auto Vic2Army = *armyFactory.getArmy("", armyInput, warnings);
 	Vic2Armies.push_back(Vic2Army);
 	theArmy.addSourceArmies(Vic2Armies);
 
@@ -481,7 +485,8 @@ TEST(HoI4World_Military_HoI4ArmyTests, DivisionsCanMapToLaterTemplate)
 		 "\t\t}\n"
 		 "\t}");
 	Vic2::Army::Factory armyFactory;
-	auto Vic2Army = *armyFactory.getArmy("", armyInput);
+	std::vector<std::string> warnings;
+	auto Vic2Army = *armyFactory.getArmy("", armyInput, warnings);
 	Vic2Armies.push_back(Vic2Army);
 	theArmy.addSourceArmies(Vic2Armies);
 
@@ -572,7 +577,8 @@ TEST(HoI4World_Military_HoI4ArmyTests, SubstituteDivisionsAllowConversion)
 		 "\t\t}\n"
 		 "\t}");
 	Vic2::Army::Factory armyFactory;
-	auto Vic2Army = *armyFactory.getArmy("", armyInput);
+	std::vector<std::string> warnings;
+	auto Vic2Army = *armyFactory.getArmy("", armyInput, warnings);
 	Vic2Armies.push_back(Vic2Army);
 	theArmy.addSourceArmies(Vic2Armies);
 
@@ -655,7 +661,8 @@ TEST(HoI4World_Military_HoI4ArmyTests, UnconvertedDivisionsMergeAndConvert)
 		 "\t\t}\n"
 		 "\t}");
 	Vic2::Army::Factory armyFactory;
-	auto Vic2Army = *armyFactory.getArmy("", armyInput);
+	std::vector<std::string> warnings;
+	auto Vic2Army = *armyFactory.getArmy("", armyInput, warnings);
 	Vic2Armies.push_back(Vic2Army);
 	std::istringstream armyInput2(
 		 "=\n"
@@ -669,7 +676,7 @@ TEST(HoI4World_Military_HoI4ArmyTests, UnconvertedDivisionsMergeAndConvert)
 		 "\t\t\ttype=infantry\n"
 		 "\t\t}\n"
 		 "\t}");
-	auto Vic2Army2 = *armyFactory.getArmy("", armyInput2);
+	auto Vic2Army2 = *armyFactory.getArmy("", armyInput2, warnings);
 	Vic2Armies.push_back(Vic2Army2);
 	theArmy.addSourceArmies(Vic2Armies);
 
@@ -750,7 +757,8 @@ TEST(HoI4World_Military_HoI4ArmyTests, DivisionLocationsAreConverted)
 		 "\t\t}\n"
 		 "\t}");
 	Vic2::Army::Factory armyFactory;
-	auto Vic2Army = *armyFactory.getArmy("", armyInput);
+	std::vector<std::string> warnings;
+	auto Vic2Army = *armyFactory.getArmy("", armyInput, warnings);
 	Vic2Armies.push_back(Vic2Army);
 	theArmy.addSourceArmies(Vic2Armies);
 
@@ -812,7 +820,8 @@ TEST(HoI4World_Military_HoI4ArmyTests, BackupDivisionLocationsAreConverted)
 		 "\t\t}\n"
 		 "\t}");
 	Vic2::Army::Factory armyFactory;
-	auto Vic2Army = *armyFactory.getArmy("", armyInput);
+	std::vector<std::string> warnings;
+	auto Vic2Army = *armyFactory.getArmy("", armyInput, warnings);
 	Vic2Armies.push_back(Vic2Army);
 	std::istringstream armyInput2(
 		 "=\n"
@@ -826,7 +835,7 @@ TEST(HoI4World_Military_HoI4ArmyTests, BackupDivisionLocationsAreConverted)
 		 "\t\t\ttype=infantry\n"
 		 "\t\t}\n"
 		 "\t}");
-	auto Vic2Army2 = *armyFactory.getArmy("", armyInput2);
+	auto Vic2Army2 = *armyFactory.getArmy("", armyInput2, warnings);
 	Vic2Armies.push_back(Vic2Army2);
 	theArmy.addSourceArmies(Vic2Armies);
 
@@ -888,7 +897,8 @@ TEST(HoI4World_Military_HoI4ArmyTests, InfantryDivisionsAreReturned)
 		 "\t\t}\n"
 		 "\t}");
 	Vic2::Army::Factory armyFactory;
-	auto Vic2Army = *armyFactory.getArmy("", armyInput);
+	std::vector<std::string> warnings;
+	auto Vic2Army = *armyFactory.getArmy("", armyInput, warnings);
 	Vic2Armies.push_back(Vic2Army);
 	theArmy.addSourceArmies(Vic2Armies);
 
@@ -943,7 +953,8 @@ TEST(HoI4World_Military_HoI4ArmyTests, CavalryDivisionsRequireEquipment)
 		 "\t\t}\n"
 		 "\t}");
 	Vic2::Army::Factory armyFactory;
-	auto Vic2Army = *armyFactory.getArmy("", armyInput);
+	std::vector<std::string> warnings;
+	auto Vic2Army = *armyFactory.getArmy("", armyInput, warnings);
 	Vic2Armies.push_back(Vic2Army);
 	theArmy.addSourceArmies(Vic2Armies);
 
@@ -997,7 +1008,8 @@ TEST(HoI4World_Military_HoI4ArmyTests, ArtilleryDivisionsAreReturned)
 		 "\t\t}\n"
 		 "\t}");
 	Vic2::Army::Factory armyFactory;
-	auto Vic2Army = *armyFactory.getArmy("", armyInput);
+	std::vector<std::string> warnings;
+	auto Vic2Army = *armyFactory.getArmy("", armyInput, warnings);
 	Vic2Armies.push_back(Vic2Army);
 	theArmy.addSourceArmies(Vic2Armies);
 
@@ -1053,7 +1065,8 @@ TEST(HoI4World_Military_HoI4ArmyTests, ArmorDivisionsAreReturned)
 		 "\t\t}\n"
 		 "\t}");
 	Vic2::Army::Factory armyFactory;
-	auto Vic2Army = *armyFactory.getArmy("", armyInput);
+	std::vector<std::string> warnings;
+	auto Vic2Army = *armyFactory.getArmy("", armyInput, warnings);
 	Vic2Armies.push_back(Vic2Army);
 	theArmy.addSourceArmies(Vic2Armies);
 
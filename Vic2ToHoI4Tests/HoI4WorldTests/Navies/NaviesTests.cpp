@@ -97,7 +97,8 @@ TEST_F(HoI4World_Navies_NaviesTests, NaviesConvertToLegacy)
 	armyStream << "\tat_sea = 0\n";
 	armyStream << "}";
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream unitMappingsStream;
@@ -182,7 +183,8 @@ TEST_F(HoI4World_Navies_NaviesTests, OnlyConvertToAvailableLegacyShipType)
 	armyStream << "\tat_sea = 0\n";
 	armyStream << "}";
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream legacyUnitMappingStream;
@@ -238,7 +240,8 @@ TEST_F(HoI4World_Navies_NaviesTests, NaviesWithoutShipsDontConvertToLegacy)
 	armyStream << "\tat_sea = 0\n";
 	armyStream << "}";
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream unitMappingsStream;
@@ -300,7 +303,8 @@ TEST_F(HoI4World_Navies_NaviesTests, NonNavalUnitsArentAddedToLegacyNavy)
 	armyStream << "\tat_sea = 0\n";
 	armyStream << "}";
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream unitMappingsStream;
@@ -362,7 +366,8 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyNavyNamesConvert)
 	armyStream << "\tat_sea = 0\n";
 	armyStream << "}";
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream unitMappingsStream;
@@ -432,7 +437,8 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyCanHave1936DestroyerInProduction)
 	std::vector<Vic2::Army> sourceArmies;
 	std::stringstream armyStream;
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream unitMappingsStream;
@@ -485,7 +491,8 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyCanHaveEarlyDestroyerInProduction)
 	std::vector<Vic2::Army> sourceArmies;
 	std::stringstream armyStream;
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream unitMappingsStream;
@@ -538,7 +545,8 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyCanHave1936BattleshipInProduction)
 	std::vector<Vic2::Army> sourceArmies;
 	std::stringstream armyStream;
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream unitMappingsStream;
@@ -591,7 +599,8 @@ TEST_F(HoI4World_Navies_NaviesTests, LegacyCanHaveEarlyBattleshipInProduction)
 	std::vector<Vic2::Army> sourceArmies;
 	std::stringstream armyStream;
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream unitMappingsStream;
@@ -658,7 +667,8 @@ TEST_F(HoI4World_Navies_NaviesTests, NaviesConvertToMtg)
 	armyStream << "\tat_sea = 0\n";
 	armyStream << "}";
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream input;
@@ -732,7 +742,8 @@ TEST_F(HoI4World_Navies_NaviesTests, OnlyConvertToAvailableMtgShipType)
 	armyStream << "\tat_sea = 0\n";
 	armyStream << "}";
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream input;
@@ -813,7 +824,8 @@ TEST_F(HoI4World_Navies_NaviesTests, ConvertedNaviesGetExperience)
 	armyStream << "\tat_sea = 0\n";
 	armyStream << "}";
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream input;
@@ -879,7 +891,8 @@ TEST_F(HoI4World_Navies_NaviesTests, NaviesWithoutShipsDontConvertToMtg)
 	armyStream << "\tat_sea = 0\n";
 	armyStream << "}";
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream input;
@@ -943,7 +956,8 @@ TEST_F(HoI4World_Navies_NaviesTests, NonNavalUnitsArentAddedToMtgNavy)
 	armyStream << "\tat_sea = 0\n";
 	armyStream << "}";
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream input;
@@ -1007,7 +1021,8 @@ TEST_F(HoI4World_Navies_NaviesTests, MtgNavyNamesConvert)
 	armyStream << "\tat_sea = 0\n";
 	armyStream << "}";
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream input;
@@ -1067,7 +1082,8 @@ TEST_F(HoI4World_Navies_NaviesTests, MtgCanHave1936DestroyerInProduction)
 	std::vector<Vic2::Army> sourceArmies;
 	std::stringstream armyStream;
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream input;
@@ -1120,7 +1136,8 @@ TEST_F(HoI4World_Navies_NaviesTests, MtgCanHaveEarlyDestroyerInProduction)
 	std::vector<Vic2::Army> sourceArmies;
 	std::stringstream armyStream;
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream input;
@@ -1173,7 +1190,8 @@ TEST_F(HoI4World_Navies_NaviesTests, MtgCanHave1936BattleshipInProduction)
 	std::vector<Vic2::Army> sourceArmies;
 	std::stringstream armyStream;
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream input;
@@ -1226,7 +1244,8 @@ TEST_F(HoI4World_Navies_NaviesTests, MtgCanHaveEarlyBattleshipInProduction)
 	std::vector<Vic2::Army> sourceArmies;
 	std::stringstream armyStream;
 	Vic2::Army::Factory armyFactory;
-	auto navy = *armyFactory.getArmy("", armyStream);
+	std::vector<std::string> warnings;
+	auto navy = *armyFactory.getArmy("", armyStream, warnings);
 	sourceArmies.push_back(navy);
 
 	std::stringstream input;
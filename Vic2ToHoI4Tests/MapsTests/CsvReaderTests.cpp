@@ -0,0 +1,84 @@
+#include "Maps/CsvReader.h"
+#include "gmock/gmock-matchers.h"
+#include "gtest/gtest.h"
+
+
+
+TEST(Maps_CsvReader, MissingFileThrowsException)
+{
+	ASSERT_THROW(const Maps::CsvReader reader("missing.csv"), std::runtime_error);
+}
+
+
+TEST(Maps_CsvReader, EmptyContentsHaveNoRecords)
+{
+	Maps::CsvReader reader("", "test.csv");
+
+	EXPECT_FALSE(reader.readRecord());
+}
+
+
+TEST(Maps_CsvReader, FieldsAreSplitOnSemicolons)
+{
+	Maps::CsvReader reader("1;two;;four", "test.csv");
+
+	ASSERT_TRUE(reader.readRecord());
+	ASSERT_EQ(reader.getNumFields(), 4);
+	EXPECT_EQ(reader.getField(0), "1");
+	EXPECT_EQ(reader.getField(1), "two");
+	EXPECT_EQ(reader.getField(2), "");
+	EXPECT_EQ(reader.getField(3), "four");
+	EXPECT_FALSE(reader.readRecord());
+}
+
+
+TEST(Maps_CsvReader, LineEndingsAndByteOrderMarkAreNotPartOfFields)
+{
+	Maps::CsvReader reader("\xEF\xBB\xBFone;two\r\nthree\n", "test.csv");
+
+	ASSERT_TRUE(reader.readRecord());
+	EXPECT_EQ(reader.getLine(), "one;two");
+	EXPECT_EQ(reader.getField(1), "two");
+	ASSERT_TRUE(reader.readRecord());
+	EXPECT_EQ(reader.getLine(), "three");
+	EXPECT_EQ(reader.getLineNumber(), 2);
+	EXPECT_FALSE(reader.readRecord());
+}
+
+
+TEST(Maps_CsvReader, NumbersCanBeRead)
+{
+	Maps::CsvReader reader("-42; 7 ;3359.50", "test.csv");
+
+	ASSERT_TRUE(reader.readRecord());
+	EXPECT_EQ(reader.getInt(0), -42);
+	EXPECT_EQ(reader.getInt(1), 7);
+	EXPECT_FLOAT_EQ(reader.getFloat(2), 3359.5F);
+}
+
+
+TEST(Maps_CsvReader, BadNumbersThrowWithLineNumber)
+{
+	Maps::CsvReader reader("1;2\n3;four", "test.csv");
+	ASSERT_TRUE(reader.readRecord());
+	ASSERT_TRUE(reader.readRecord());
+
+	try
+	{
+		[[maybe_unused]] const auto number = reader.getInt(1);
+		FAIL();
+	}
+	catch (const std::runtime_error& error)
+	{
+		EXPECT_STREQ(error.what(), "test.csv line 2: 'four' is not an integer");
+	}
+}
+
+
+TEST(Maps_CsvReader, MissingFieldsThrowException)
+{
+	Maps::CsvReader reader("1;2", "test.csv");
+	ASSERT_TRUE(reader.readRecord());
+
+	EXPECT_THROW([[maybe_unused]] const auto field = reader.getField(2), std::runtime_error);
+}
@@ -86,6 +86,24 @@ TEST(Maps_MapData, NeighborDefinedFromAbove)
 }
 
 
+TEST(Maps_MapData, NeighborsAreInAscendingOrder)
+{
+	const Maps::ProvinceDefinitions provinceDefinitions({},
+		 {},
+		 {},
+		 {
+			  {0x88'00'15, 1}, // the dark red one on top
+			  {0xED'1C'24, 2}, // the red red one on the left
+			  {0x22'B1'4C, 3}, // the green one in the middle
+			  {0xFF'7F'27, 4}, // the orange one on the right
+			  {0xFF'F2'00, 5}, // the yellow red one below
+		 });
+	const Maps::MapData mapData(provinceDefinitions, "maptests");
+
+	EXPECT_THAT(mapData.getNeighbors(3), testing::ElementsAre(1, 2, 4, 5));
+}
+
+
 TEST(Maps_MapData, NeighborDefinedFromNonImpassableAdjacency)
 {
 	const Maps::ProvinceDefinitions provinceDefinitions({}, {}, {}, {});
@@ -260,6 +278,23 @@ TEST(Maps_MapData, ProvinceNumberForDefinedPoint)
 }
 
 
+TEST(Maps_MapData, NoProvinceNumberForPointOffMap)
+{
+	const Maps::ProvinceDefinitions provinceDefinitions({},
+		 {},
+		 {},
+		 {
+			  {0x88'00'15, 1}, // the dark red one on top
+		 });
+	const Maps::MapData mapData(provinceDefinitions, "maptests");
+
+	EXPECT_EQ(mapData.getProvinceNumber({-1, 595}), std::nullopt);
+	EXPECT_EQ(mapData.getProvinceNumber({13, -1}), std::nullopt);
+	EXPECT_EQ(mapData.getProvinceNumber({100'000, 595}), std::nullopt);
+	EXPECT_EQ(mapData.getProvinceNumber({13, 100'000}), std::nullopt);
+}
+
+
 TEST(Maps_MapData, NoProvincePointsForUndefinedProvince)
 {
 	const Maps::ProvinceDefinitions provinceDefinitions({}, {}, {}, {});
@@ -284,4 +319,32 @@ TEST(Maps_MapData, ProvincePointsForDefinedProvince)
 
 	Maps::Point expectedPoint{13, 595};
 	EXPECT_EQ(provincePoints->getCentermostPoint(), expectedPoint);
-}
\ No newline at end of file
+}
+
+
+TEST(Maps_MapData, NoCentermostPointForUndefinedProvince)
+{
+	const Maps::ProvinceDefinitions provinceDefinitions({}, {}, {}, {});
+	const Maps::MapData mapData(provinceDefinitions, "maptests");
+
+	EXPECT_EQ(mapData.getCentermostPoint(42), std::nullopt);
+	EXPECT_EQ(mapData.getCentermostPoint(-1), std::nullopt);
+}
+
+
+TEST(Maps_MapData, CentermostPointForDefinedProvince)
+{
+	const Maps::ProvinceDefinitions provinceDefinitions({},
+		 {},
+		 {},
+		 {
+			  {0x88'00'15, 1}, // the dark red one on top
+		 });
+	const Maps::MapData mapData(provinceDefinitions, "maptests");
+
+	const auto centermostPoint = mapData.getCentermostPoint(1);
+	ASSERT_TRUE(centermostPoint);
+
+	constexpr Maps::Point expectedPoint{13, 595};
+	EXPECT_EQ(*centermostPoint, expectedPoint);
+}
@@ -97,6 +97,34 @@ TEST(Maps_ProvinceDefinitions, ProvincesCanBeLookedUpByColor)
 }
 
 
+TEST(Maps_ProvinceDefinitions, ProvincesCanBeLookedUpByPackedColor)
+{
+	const Maps::ProvinceDefinitions provinceDefinitions({}, {}, {}, {{{0x00'00'00, 1}, {0x10'20'30, 10}}});
+
+	EXPECT_EQ(provinceDefinitions.getProvinceFromColor(0x00'00'00), 1);
+	EXPECT_EQ(provinceDefinitions.getProvinceFromColor(0x10'20'30), 10);
+	EXPECT_EQ(provinceDefinitions.getProvinceFromColor(0x10'20'31), std::nullopt);
+	EXPECT_EQ(provinceDefinitions.getProvinceFromColor(-1), std::nullopt);
+}
+
+
+TEST(Maps_ProvinceDefinitions, ManyProvincesCanBeLookedUpByColor)
+{
+	std::map<int, int> colorToProvinceMap;
+	for (int province = 1; province <= 5000; province++)
+	{
+		colorToProvinceMap.emplace(province * 3301, province);
+	}
+	const Maps::ProvinceDefinitions provinceDefinitions({}, {}, {}, colorToProvinceMap);
+
+	for (int province = 1; province <= 5000; province++)
+	{
+		EXPECT_EQ(provinceDefinitions.getProvinceFromColor(province * 3301), province);
+		EXPECT_EQ(provinceDefinitions.getProvinceFromColor(province * 3301 + 1), std::nullopt);
+	}
+}
+
+
 TEST(Maps_ProvinceDefinitions, TerrainTypeDefaultsToEmpty)
 {
 	const Maps::ProvinceDefinitions provinceDefinitions({}, {}, {}, {});
@@ -47,4 +47,54 @@ TEST(Maps_ProvincePoints, CentermostPointWhenCenterNotControlled)
 
 	constexpr Maps::Point expectedPoint{3, 0};
 	EXPECT_EQ(expectedPoint, provincePoints.getCentermostPoint());
-}
\ No newline at end of file
+}
+
+TEST(Maps_ProvincePoints, CenterPointIsAverageOfRuns)
+{
+	Maps::ProvincePoints provincePoints;
+	provincePoints.addRun(0, 1, 4);
+	provincePoints.addRun(1, 1, 4);
+	provincePoints.addRun(2, 1, 4);
+
+	constexpr Maps::Point expectedPoint{2, 1};
+	EXPECT_EQ(expectedPoint, provincePoints.getCentermostPoint());
+}
+
+
+TEST(Maps_ProvincePoints, CentermostPointWhenCenterNotInAnyRun)
+{
+	Maps::ProvincePoints provincePoints;
+	provincePoints.addRun(0, 0, 10);
+	provincePoints.addRun(4, 0, 2);
+	provincePoints.addRun(4, 8, 10);
+
+	constexpr Maps::Point expectedPoint{5, 0};
+	EXPECT_EQ(expectedPoint, provincePoints.getCentermostPoint());
+}
+
+
+TEST(Maps_ProvincePoints, CentermostPointTiesGoToLowestPoint)
+{
+	Maps::ProvincePoints provincePoints;
+	provincePoints.addPoint(Maps::Point{4, 2});
+	provincePoints.addPoint(Maps::Point{2, 4});
+	provincePoints.addPoint(Maps::Point{2, 0});
+	provincePoints.addPoint(Maps::Point{0, 2});
+
+	constexpr Maps::Point expectedPoint{0, 2};
+	EXPECT_EQ(expectedPoint, provincePoints.getCentermostPoint());
+}
+
+
+TEST(Maps_ProvincePoints, PointsCanBeFoundInRuns)
+{
+	Maps::ProvincePoints provincePoints;
+	provincePoints.addRun(3, 1, 4);
+	provincePoints.addPoint(Maps::Point{5, 3});
+
+	EXPECT_FALSE(provincePoints.contains(Maps::Point{0, 3}));
+	EXPECT_TRUE(provincePoints.contains(Maps::Point{1, 3}));
+	EXPECT_TRUE(provincePoints.contains(Maps::Point{5, 3}));
+	EXPECT_FALSE(provincePoints.contains(Maps::Point{6, 3}));
+	EXPECT_FALSE(provincePoints.contains(Maps::Point{2, 2}));
+}
@@ -0,0 +1,150 @@
+#include "OSCompatibilityLayer.h"
+#include "OutHoi4/Flags/FlagCache.h"
+#include "gtest/gtest.h"
+#include <fstream>
+#include <sstream>
+
+
+
+namespace
+{
+
+void writeFile(const std::string& path, const std::string& contents)
+{
+	std::ofstream file(path, std::ios::binary);
+	file << contents;
+}
+
+
+std::string readFile(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	std::stringstream contents;
+	contents << file.rdbuf();
+	return contents.str();
+}
+
+} // namespace
+
+
+
+TEST(OutHoI4_Flags_FlagCacheKey, KeysDependOnFileContentsNotNames)
+{
+	commonItems::TryCreateFolder("OutHoI4Tests");
+	commonItems::TryCreateFolder("OutHoI4Tests/Flags");
+	writeFile("OutHoI4Tests/Flags/keyOne.tga", "flag");
+	writeFile("OutHoI4Tests/Flags/keyTwo.tga", "flag");
+	writeFile("OutHoI4Tests/Flags/keyThree.tga", "other flag");
+
+	HoI4::FlagCacheKey keyOne;
+	keyOne.addFile("OutHoI4Tests/Flags/keyOne.tga");
+	HoI4::FlagCacheKey keyTwo;
+	keyTwo.addFile("OutHoI4Tests/Flags/keyTwo.tga");
+	HoI4::FlagCacheKey keyThree;
+	keyThree.addFile("OutHoI4Tests/Flags/keyThree.tga");
+
+	EXPECT_EQ(keyOne.getKey(), keyTwo.getKey());
+	EXPECT_NE(keyOne.getKey(), keyThree.getKey());
+}
+
+
+TEST(OutHoI4_Flags_FlagCacheKey, MissingFilesDifferFromEmptyFiles)
+{
+	commonItems::TryCreateFolder("OutHoI4Tests");
+	commonItems::TryCreateFolder("OutHoI4Tests/Flags");
+	writeFile("OutHoI4Tests/Flags/empty.tga", "");
+
+	HoI4::FlagCacheKey emptyKey;
+	emptyKey.addFile("OutHoI4Tests/Flags/empty.tga");
+	HoI4::FlagCacheKey missingKey;
+	missingKey.addFile("OutHoI4Tests/Flags/missing.tga");
+	HoI4::FlagCacheKey noPathKey;
+	noPathKey.addFile(std::nullopt);
+
+	EXPECT_NE(emptyKey.getKey(), missingKey.getKey());
+	EXPECT_EQ(missingKey.getKey(), noPathKey.getKey());
+}
+
+
+TEST(OutHoI4_Flags_FlagCacheKey, FileHashesCanStandInForFiles)
+{
+	commonItems::TryCreateFolder("OutHoI4Tests");
+	commonItems::TryCreateFolder("OutHoI4Tests/Flags");
+	writeFile("OutHoI4Tests/Flags/hashed.tga", "flag");
+
+	HoI4::FlagCacheKey fileKey;
+	fileKey.addFile("OutHoI4Tests/Flags/hashed.tga");
+	HoI4::FlagCacheKey hashKey;
+	hashKey.addFileHash(HoI4::FlagCacheKey::hashFile("OutHoI4Tests/Flags/hashed.tga"));
+	HoI4::FlagCacheKey missingHashKey;
+	missingHashKey.addFileHash(HoI4::FlagCacheKey::hashFile("OutHoI4Tests/Flags/missing.tga"));
+
+	EXPECT_EQ(fileKey.getKey(), hashKey.getKey());
+	EXPECT_NE(fileKey.getKey(), missingHashKey.getKey());
+}
+
+
+TEST(OutHoI4_Flags_FlagCacheKey, InputsAreKeptSeparate)
+{
+	HoI4::FlagCacheKey keyOne;
+	keyOne.addText("ab");
+	keyOne.addText("c");
+	HoI4::FlagCacheKey keyTwo;
+	keyTwo.addText("a");
+	keyTwo.addText("bc");
+
+	EXPECT_NE(keyOne.getKey(), keyTwo.getKey());
+	EXPECT_EQ(16, keyOne.getKey().size());
+}
+
+
+TEST(OutHoI4_Flags_FlagCache, MissingFlagsAreNotCopied)
+{
+	commonItems::TryCreateFolder("OutHoI4Tests");
+	commonItems::TryCreateFolder("OutHoI4Tests/Flags");
+	commonItems::TryCreateFolder("OutHoI4Tests/Flags/cache");
+	HoI4::FlagCache cache("OutHoI4Tests/Flags/cache");
+
+	EXPECT_FALSE(cache.hasFlag("missing"));
+	EXPECT_FALSE(cache.copyFlag("missing", "OutHoI4Tests/Flags/missingCopy.tga"));
+	EXPECT_FALSE(commonItems::DoesFileExist("OutHoI4Tests/Flags/missingCopy.tga"));
+}
+
+
+TEST(OutHoI4_Flags_FlagCache, StoredFlagsCanBeCopied)
+{
+	commonItems::TryCreateFolder("OutHoI4Tests");
+	commonItems::TryCreateFolder("OutHoI4Tests/Flags");
+	commonItems::TryCreateFolder("OutHoI4Tests/Flags/cache");
+	writeFile("OutHoI4Tests/Flags/stored.tga", "stored flag");
+	HoI4::FlagCache cache("OutHoI4Tests/Flags/cache");
+
+	cache.storeFlag("stored", "OutHoI4Tests/Flags/stored.tga");
+
+	EXPECT_TRUE(cache.hasFlag("stored"));
+	ASSERT_TRUE(cache.copyFlag("stored", "OutHoI4Tests/Flags/storedCopy.tga"));
+	EXPECT_EQ("stored flag", readFile("OutHoI4Tests/Flags/storedCopy.tga"));
+}
+
+
+TEST(OutHoI4_Flags_FlagCache, UnusedFlagsAreRemoved)
+{
+	commonItems::TryCreateFolder("OutHoI4Tests");
+	commonItems::TryCreateFolder("OutHoI4Tests/Flags");
+	commonItems::TryCreateFolder("OutHoI4Tests/Flags/prunedCache");
+	writeFile("OutHoI4Tests/Flags/pruned.tga", "flag");
+	HoI4::FlagCache firstCache("OutHoI4Tests/Flags/prunedCache");
+	firstCache.storeFlag("copied", "OutHoI4Tests/Flags/pruned.tga");
+	firstCache.storeFlag("unused", "OutHoI4Tests/Flags/pruned.tga");
+	writeFile("OutHoI4Tests/Flags/prunedCache/leftover.tga.1", "flag");
+
+	HoI4::FlagCache secondCache("OutHoI4Tests/Flags/prunedCache");
+	ASSERT_TRUE(secondCache.copyFlag("copied", "OutHoI4Tests/Flags/prunedCopy.tga"));
+	secondCache.storeFlag("stored", "OutHoI4Tests/Flags/pruned.tga");
+	secondCache.removeUnusedFlags();
+
+	EXPECT_TRUE(secondCache.hasFlag("copied"));
+	EXPECT_TRUE(secondCache.hasFlag("stored"));
+	EXPECT_FALSE(secondCache.hasFlag("unused"));
+	EXPECT_FALSE(commonItems::DoesFileExist("OutHoI4Tests/Flags/prunedCache/leftover.tga.1"));
+}
@@ -0,0 +1,83 @@
+#include "OutHoi4/Flags/FlagResampler.h"
+#include "gtest/gtest.h"
+
+
+
+TEST(OutHoI4_Flags_FlagResampler, NearestCopiesTopLeftPixelOfEachCoveredArea)
+{
+	const std::vector<uint8_t> source{
+		 1, 2, 3, 0, 4, 5, 6, 0, 7, 8, 9, 0, 10, 11, 12, 0, // first row
+		 13, 14, 15, 0, 16, 17, 18, 0, 19, 20, 21, 0, 22, 23, 24, 0 // second row
+	};
+
+	const auto images = HoI4::resampleFlag(source.data(), 4, 2, 4, {{2, 1}});
+
+	ASSERT_EQ(1, images.size());
+	EXPECT_EQ(std::vector<uint8_t>({1, 2, 3, 0xFF, 7, 8, 9, 0xFF}), images[0]);
+}
+
+
+TEST(OutHoI4_Flags_FlagResampler, TwentyFourBitSourcesCanBeResampled)
+{
+	const std::vector<uint8_t> source{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+
+	const auto images = HoI4::resampleFlag(source.data(), 2, 2, 3, {{1, 1}});
+
+	ASSERT_EQ(1, images.size());
+	EXPECT_EQ(std::vector<uint8_t>({1, 2, 3, 0xFF}), images[0]);
+}
+
+
+TEST(OutHoI4_Flags_FlagResampler, EnlargingRepeatsSourcePixels)
+{
+	const std::vector<uint8_t> source{1, 2, 3, 0, 4, 5, 6, 0};
+
+	const auto images = HoI4::resampleFlag(source.data(), 2, 1, 4, {{4, 2}});
+
+	ASSERT_EQ(1, images.size());
+	EXPECT_EQ(std::vector<uint8_t>({1, 2, 3, 0xFF, 1, 2, 3, 0xFF, 4, 5, 6, 0xFF, 4, 5, 6, 0xFF, // first row
+						1, 2, 3, 0xFF, 1, 2, 3, 0xFF, 4, 5, 6, 0xFF, 4, 5, 6, 0xFF}),	// second row
+		 images[0]);
+}
+
+
+TEST(OutHoI4_Flags_FlagResampler, BoxFilterAveragesCoveredPixels)
+{
+	const std::vector<uint8_t> source{
+		 0, 10, 100, 0, 2, 20, 200, 0, // first row
+		 4, 30, 100, 0, 6, 40, 200, 0	// second row
+	};
+
+	const auto images = HoI4::resampleFlag(source.data(), 2, 2, 4, {{1, 1, HoI4::ResampleFilter::Box}});
+
+	ASSERT_EQ(1, images.size());
+	EXPECT_EQ(std::vector<uint8_t>({3, 25, 150, 0xFF}), images[0]);
+}
+
+
+TEST(OutHoI4_Flags_FlagResampler, EachSizeIsMadeInOrder)
+{
+	const std::vector<uint8_t> source{
+		 0, 0, 0, 0, 10, 10, 10, 0, // first row
+		 20, 20, 20, 0, 30, 30, 30, 0 // second row
+	};
+
+	const auto images = HoI4::resampleFlag(source.data(),
+		 2,
+		 2,
+		 4,
+		 {{2, 2}, {1, 1}, {1, 1, HoI4::ResampleFilter::Box}});
+
+	ASSERT_EQ(3, images.size());
+	EXPECT_EQ(source.size(), images[0].size());
+	EXPECT_EQ(std::vector<uint8_t>({0, 0, 0, 0xFF}), images[1]);
+	EXPECT_EQ(std::vector<uint8_t>({15, 15, 15, 0xFF}), images[2]);
+}
+
+
+TEST(OutHoI4_Flags_FlagResampler, UnsupportedPixelDepthsThrowException)
+{
+	const std::vector<uint8_t> source{1, 2};
+
+	EXPECT_THROW(const auto images = HoI4::resampleFlag(source.data(), 1, 1, 2, {{1, 1}}), std::runtime_error);
+}
@@ -27,16 +27,19 @@ TEST(Vic2World_Countries_CountryTests, TagIsAsSet)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ("TAG", country->getTag());
 }
@@ -50,16 +53,19 @@ TEST(Vic2World_Countries_CountryTests, ColorIsFromCommonCountryData)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().setColor(testColor).Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(testColor, country->getColor());
 }
@@ -71,16 +77,19 @@ TEST(Vic2World_Countries_CountryTests, HumanDefaultsToFalse)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_FALSE(country->isHuman());
 }
@@ -93,16 +102,19 @@ TEST(Vic2World_Countries_CountryTests, HumanCanBeSet)
 	theStream << "\truling_party = 1\n";
 	theStream << "\thuman = yes\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->isHuman());
 }
@@ -115,16 +127,19 @@ TEST(Vic2World_Countries_CountryTests, HumanNotSetWithoutYes)
 	theStream << "\truling_party = 1\n";
 	theStream << "\thuman = whatever\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_FALSE(country->isHuman());
 }
@@ -136,16 +151,19 @@ TEST(Vic2World_Countries_CountryTests, StatesDefaultToEmpty)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getStates().empty());
 }
@@ -159,16 +177,19 @@ TEST(Vic2World_Countries_CountryTests, StatesCanBeImported)
 	theStream << "\tstate = {\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(1, country->getStates().size());
 }
@@ -180,16 +201,19 @@ TEST(Vic2World_Countries_CountryTests, DoesNotHaveLandByDefault)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_FALSE(country->hasLand());
 }
@@ -201,16 +225,19 @@ TEST(Vic2World_Countries_CountryTests, HasLandWhenGivenProvinces)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	country->addProvince(1, std::make_shared<Vic2::Province>());
 
 	ASSERT_TRUE(country->hasLand());
@@ -223,16 +250,19 @@ TEST(Vic2World_Countries_CountryTests, IsEmptyByDefault)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->isEmpty());
 }
@@ -244,16 +274,19 @@ TEST(Vic2World_Countries_CountryTests, IsNotEmptyWhenGivenProvinces)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	country->addProvince(1, std::make_shared<Vic2::Province>());
 
 	ASSERT_FALSE(country->isEmpty());
@@ -266,16 +299,19 @@ TEST(Vic2World_Countries_CountryTests, IsNotEmptyWhenGivenCores)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	country->addCore(std::make_shared<Vic2::Province>());
 
 	ASSERT_FALSE(country->isEmpty());
@@ -288,16 +324,19 @@ TEST(Vic2World_Countries_CountryTests, CoresDefaultToEmpty)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getCores().empty());
 }
@@ -309,16 +348,19 @@ TEST(Vic2World_Countries_CountryTests, CoresCanBeAdded)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	country->addCore(Vic2::Province::Builder().setNumber(1).build());
 
 	ASSERT_EQ(1, country->getCores().size());
@@ -332,16 +374,19 @@ TEST(Vic2World_Countries_CountryTests, CoresCanBeReplaced)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	country->addCore(Vic2::Province::Builder().setNumber(1).build());
 	country->replaceCores({Vic2::Province::Builder().setNumber(2).build()});
 
@@ -356,16 +401,19 @@ TEST(Vic2World_Countries_CountryTests, CapitalDefaultsToZero)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(0, country->getCapital());
 }
@@ -378,16 +426,19 @@ TEST(Vic2World_Countries_CountryTests, CapitalCanBeSet)
 	theStream << "\truling_party = 1\n";
 	theStream << "\tcapital = 42\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(42, country->getCapital());
 }
@@ -399,16 +450,19 @@ TEST(Vic2World_Countries_CountryTests, PrimaryCultureDefaultsToNoCulture)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ("no_culture", country->getPrimaryCulture());
 }
@@ -421,16 +475,19 @@ TEST(Vic2World_Countries_CountryTests, PrimaryCultureCanBeSet)
 	theStream << "\truling_party = 1\n";
 	theStream << "\tprimary_culture = test_primary\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ("test_primary", country->getPrimaryCulture());
 }
@@ -443,16 +500,19 @@ TEST(Vic2World_Countries_CountryTests, PrimaryCultureWithQuotesCanBeSet)
 	theStream << "\truling_party = 1\n";
 	theStream << "\tprimary_culture = \"test_primary\"\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ("test_primary", country->getPrimaryCulture());
 }
@@ -464,16 +524,19 @@ TEST(Vic2World_Countries_CountryTests, PrimaryCultureCanBeSetFromLargestCulture)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countryTests/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	country->addProvince(1,
 		 Vic2::Province::Builder()
 			  .setNumber(1)
@@ -494,16 +557,19 @@ TEST(Vic2World_Countries_CountryTests, PrimaryCultureCanBeSetFromMultiplePopsAdd
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countryTests/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	country->addProvince(1,
 		 Vic2::Province::Builder()
 			  .setNumber(1)
@@ -525,16 +591,19 @@ TEST(Vic2World_Countries_CountryTests, PrimaryCultureNotSetFromLargestCultureIfN
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countryTests/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	country->handleMissingCulture(*Vic2::CultureGroups::Factory().getCultureGroups(
 		 *Configuration::Builder().setVic2Path("./countryTests/").build()));
@@ -549,16 +618,19 @@ TEST(Vic2World_Countries_CountryTests, PrimaryCultureGroupDefaultsToNoCulture)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ("no_culture", country->getPrimaryCultureGroup());
 }
@@ -572,17 +644,20 @@ TEST(Vic2World_Countries_CountryTests, PrimaryCultureGroupsSetFromPrimaryCulture
 	theStream << "\truling_party = 1\n";
 	theStream << "\tprimary_culture = test_primary\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countryTests/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(
 			  *Configuration::Builder().setVic2Path("./countryTests/").build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ("test_primary_group", country->getPrimaryCultureGroup());
 }
@@ -594,16 +669,19 @@ TEST(Vic2World_Countries_CountryTests, PrimaryCulturGroupeNotSetFromLargestCultu
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countryTests/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	country->handleMissingCulture(*Vic2::CultureGroups::Factory().getCultureGroups(
 		 *Configuration::Builder().setVic2Path("./countryTests/").build()));
@@ -618,16 +696,19 @@ TEST(Vic2World_Countries_CountryTests, PrimaryCultureGroupCanBeSetFromLargestCul
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countryTests/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	country->addProvince(1,
 		 Vic2::Province::Builder()
 			  .setNumber(1)
@@ -648,16 +729,19 @@ TEST(Vic2World_Countries_CountryTests, PrimaryCultureGroupBecomesNoCultureIfUnse
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 	country->handleMissingCulture(*Vic2::CultureGroups::Factory().getCultureGroups(
 		 *Configuration::Builder().setVic2Path("./countries/blank/").build()));
 
@@ -671,16 +755,19 @@ TEST(Vic2World_Countries_CountryTests, AcceptedCulturesDefaultToEmpty)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getAcceptedCultures().empty());
 }
@@ -693,16 +780,19 @@ TEST(Vic2World_Countries_CountryTests, AcceptedCulturesIncludePrimaryCulture)
 	theStream << "\truling_party = 1\n";
 	theStream << "\tprimary_culture = test_primary\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_THAT(country->getAcceptedCultures(), testing::UnorderedElementsAre("test_primary"));
 }
@@ -718,16 +808,19 @@ TEST(Vic2World_Countries_CountryTests, AcceptedCulturesCanBeAdded)
 	theStream << "\t\t\"test_primary2\"\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_THAT(country->getAcceptedCultures(), testing::UnorderedElementsAre("test_primary", "test_primary2"));
 }
@@ -743,16 +836,19 @@ TEST(Vic2World_Countries_CountryTests, AcceptedCulturesIdentifiedAsAcceptedCultu
 	theStream << "\t\t\"test_primary2\"\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->isAnAcceptedCulture("test_primary"));
 	ASSERT_TRUE(country->isAnAcceptedCulture("test_primary2"));
@@ -765,16 +861,19 @@ TEST(Vic2World_Countries_CountryTests, NonAcceptedCulturesNotIdentifiedAsAccepte
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_FALSE(country->isAnAcceptedCulture("fake_culture"));
 }
@@ -786,16 +885,19 @@ TEST(Vic2World_Countries_CountryTests, TechnologiesAndInventionsDefaultToEmpty)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getTechnologiesAndInventions().empty());
 }
@@ -811,16 +913,19 @@ TEST(Vic2World_Countries_CountryTests, TechnologiesAndInventionsCanBeAddedFromTe
 	theStream << "\t\ttechnology_two = {}\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_THAT(country->getTechnologiesAndInventions(),
 		 testing::UnorderedElementsAre("technology_one", "technology_two"));
@@ -834,16 +939,19 @@ TEST(Vic2World_Countries_CountryTests, TechnologiesAndInventionsCanBeAddedFromIn
 	theStream << "\truling_party = 1\n";
 	theStream << "\tactive_inventions = { 1 4 5 }\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countryTests/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_THAT(country->getTechnologiesAndInventions(),
 		 testing::UnorderedElementsAre("first_invention", "fourth_invention", "fifth_invention"));
@@ -856,16 +964,19 @@ TEST(Vic2World_Countries_CountryTests, RelationsDefaultToEmpty)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getRelations().empty());
 }
@@ -881,16 +992,19 @@ TEST(Vic2World_Countries_CountryTests, RelationsCanBeAdded)
 	theStream << "\t\tvalue=42\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_THAT(country->getRelations(),
 		 testing::UnorderedElementsAre(
@@ -904,16 +1018,19 @@ TEST(Vic2World_Countries_CountryTests, AiDefaultsToEmpty)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getAI().getStrategies().empty());
 }
@@ -932,16 +1049,19 @@ TEST(Vic2World_Countries_CountryTests, AiCanBeImported)
 	theStream << "\t\t}\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(1, country->getAI().getStrategies().size());
 	ASSERT_EQ("protect", country->getAI().getStrategies()[0].getType());
@@ -968,16 +1088,19 @@ TEST(Vic2World_Countries_CountryTests, AiConquerStrategiesCanBeConsolidated)
 	theStream << "\t\t}\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	country->consolidateConquerStrategies(
 		 {std::make_pair(1, Vic2::Province::Builder().setNumber(1).setOwner("TWO").build()),
 			  std::make_pair(2, Vic2::Province::Builder().setNumber(2).setOwner("TWO").build())});
@@ -992,16 +1115,19 @@ TEST(Vic2World_Countries_CountryTests, CivilizedDefaultsToFalse)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_FALSE(country->isCivilized());
 }
@@ -1014,16 +1140,19 @@ TEST(Vic2World_Countries_CountryTests, CivilizedCanBeSet)
 	theStream << "\truling_party = 1\n";
 	theStream << "\tcivilized = yes\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->isCivilized());
 }
@@ -1036,16 +1165,19 @@ TEST(Vic2World_Countries_CountryTests, CivilizedNotSetWithoutYes)
 	theStream << "\truling_party = 1\n";
 	theStream << "\tcivilized = no\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_FALSE(country->isCivilized());
 }
@@ -1057,16 +1189,19 @@ TEST(Vic2World_Countries_CountryTests, ArmiesDefaultsToEmpty)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getArmies().empty());
 }
@@ -1082,16 +1217,19 @@ TEST(Vic2World_Countries_CountryTests, ArmiesCanBeAdded)
 	theStream << "\t\t\tname=\"42nd Army\"\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(1, country->getArmies().size());
 	ASSERT_EQ("42nd Army", country->getArmies()[0].getName());
@@ -1108,16 +1246,19 @@ TEST(Vic2World_Countries_CountryTests, ArmiesCanBeModified)
 	theStream << "\t\t\tname=\"42nd Army\"\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	ASSERT_EQ(1, country->getModifiableArmies().size());
 	country->getModifiableArmies()[0].setLocation(144);
@@ -1136,16 +1277,19 @@ TEST(Vic2World_Countries_CountryTests, NaviesCanBeAdded)
 	theStream << "\t\t\tname=\"42nd Fleet\"\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(1, country->getArmies().size());
 	ASSERT_EQ("42nd Fleet", country->getArmies()[0].getName());
@@ -1166,16 +1310,19 @@ TEST(Vic2World_Countries_CountryTests, TransportedArmiesCanBeAdded)
 	theStream << "\t\t}\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(2, country->getArmies().size());
 	ASSERT_EQ("42nd Army", country->getArmies()[0].getName());
@@ -1189,16 +1336,19 @@ TEST(Vic2World_Countries_CountryTests, LeadersDefaultToEmpty)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getLeaders().empty());
 }
@@ -1216,16 +1366,19 @@ TEST(Vic2World_Countries_CountryTests, LeadersCanBeAdded)
 	theStream << "\t\t\tprestige=20\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  1.0,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(1, country->getLeaders().size());
 	ASSERT_EQ(20, country->getLeaders()[0].getPrestige());
@@ -1261,16 +1414,19 @@ TEST(Vic2World_Countries_CountryTests, GeneralsAndAdmiralsAreLimited)
 	theStream << "\t\t\ttype=sea\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.5F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(2, country->getLeaders().size());
 	ASSERT_EQ(20, country->getLeaders()[0].getPrestige());
@@ -1284,16 +1440,19 @@ TEST(Vic2World_Countries_CountryTests, RevanchismDefaultsToZero)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_NEAR(0.0, country->getRevanchism(), 0.0001);
 }
@@ -1306,16 +1465,19 @@ TEST(Vic2World_Countries_CountryTests, RevanchismCanBeSet)
 	theStream << "\truling_party = 1\n";
 	theStream << "\trevanchism = 4.2\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_NEAR(4.2, country->getRevanchism(), 0.0001);
 }
@@ -1327,16 +1489,19 @@ TEST(Vic2World_Countries_CountryTests, WarExhaustionDefaultsToZero)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_NEAR(0.0, country->getWarExhaustion(), 0.0001);
 }
@@ -1349,16 +1514,19 @@ TEST(Vic2World_Countries_CountryTests, WarExhaustionCanBeSet)
 	theStream << "\truling_party = 1\n";
 	theStream << "\twar_exhaustion = 4.2\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_NEAR(4.2, country->getWarExhaustion(), 0.0001);
 }
@@ -1370,16 +1538,19 @@ TEST(Vic2World_Countries_CountryTests, BadBoyDefaultsToZero)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_NEAR(0.0, country->getBadBoy(), 0.0001);
 }
@@ -1392,16 +1563,19 @@ TEST(Vic2World_Countries_CountryTests, BadBoyCanBeSet)
 	theStream << "\truling_party = 1\n";
 	theStream << "\tbadboy = 4.2\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_NEAR(4.2, country->getBadBoy(), 0.0001);
 }
@@ -1413,16 +1587,19 @@ TEST(Vic2World_Countries_CountryTests, FlagsDefaultToEmpty)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getFlags().empty());
 }
@@ -1440,16 +1617,19 @@ TEST(Vic2World_Countries_CountryTests, FlagsCanBeSet)
 	theStream << "\t\ttest_flag_three=nobody_cares_what_this_is\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_THAT(country->getFlags(), testing::UnorderedElementsAre("test_flag_one", "test_flag_two", "test_flag_three"));
 }
@@ -1461,16 +1641,19 @@ TEST(Vic2World_Countries_CountryTests, GovernmentDefaultsToBlank)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getGovernment().empty());
 }
@@ -1483,16 +1666,19 @@ TEST(Vic2World_Countries_CountryTests, GovernmentCanBeSet)
 	theStream << "\truling_party = 1\n";
 	theStream << "\tgovernment=test_government\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ("test_government", country->getGovernment());
 }
@@ -1504,16 +1690,19 @@ TEST(Vic2World_Countries_CountryTests, UpperHouseCompositionDefaultsToEmpty)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getUpperHouseComposition().empty());
 }
@@ -1531,16 +1720,19 @@ TEST(Vic2World_Countries_CountryTests, UpperHouseCompositionCanBeSet)
 	theStream << "\t\tideology_three=0.125\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_THAT(country->getUpperHouseComposition(),
 		 testing::UnorderedElementsAre(testing::Pair(std::string("ideology_one"), 0.25),
@@ -1563,23 +1755,26 @@ TEST(Vic2World_Countries_CountryTests, UpperHouseCompositionLogsErrorOnBadInput)
 	std::stringstream log;
 	auto* stdOutBuf = std::cout.rdbuf();
 	std::cout.rdbuf(log.rdbuf());
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 	std::cout.rdbuf(stdOutBuf);
 
 	ASSERT_EQ(
 		 "    [INFO] Determining culture groups\n"
-		 "   [ERROR] Could not open /common/cultures.txt for parsing.\n"
-		 " [WARNING] Malformed input while importing upper house composition for TAG\n",
+		 "   [ERROR] Could not open /common/cultures.txt for parsing.\n",
 		 log.str());
+	ASSERT_THAT(warnings, testing::ElementsAre("Malformed input while importing upper house composition for TAG"));
 }
 
 
@@ -1590,23 +1785,26 @@ TEST(Vic2World_Countries_CountryTests, RulingPartyUnsetLogsWarning)
 	std::cout.rdbuf(log.rdbuf());
 
 	std::stringstream theStream;
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 	std::cout.rdbuf(stdOutBuf);
 
 	ASSERT_EQ(
 		 "    [INFO] Determining culture groups\n"
-		 "   [ERROR] Could not open /common/cultures.txt for parsing.\n"
-		 " [WARNING] TAG had no ruling party. The save may need manual repair.\n",
+		 "   [ERROR] Could not open /common/cultures.txt for parsing.\n",
 		 log.str());
+	ASSERT_THAT(warnings, testing::ElementsAre("TAG had no ruling party. The save may need manual repair."));
 	ASSERT_EQ(std::nullopt, country->getRulingParty());
 }
 
@@ -1626,13 +1824,16 @@ TEST(Vic2World_Countries_CountryTests, RulingPartyNonexistantThrowsException)
 		 {
 			 try
 			 {
+				 Vic2::SaveTokenizer tokenizer(theStream.view());
+				 std::vector<std::string> warnings;
 				 countryFactory.createCountry("TAG",
-					  theStream,
+					  tokenizer,
 					  *Vic2::CommonCountryData::Builder().Build(),
 					  {},
 					  *Vic2::StateLanguageCategories::Builder().build(),
 					  0.05F,
-					  std::nullopt);
+					  std::nullopt,
+					  warnings);
 			 }
 			 catch (const std::runtime_error& e)
 			 {
@@ -1654,16 +1855,19 @@ TEST(Vic2World_Countries_CountryTests, RulingPartyCanBeSet)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().setName("test_party").Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_NE(std::nullopt, country->getRulingParty());
 	ASSERT_EQ("test_party", country->getRulingParty()->getName());
@@ -1676,16 +1880,19 @@ TEST(Vic2World_Countries_CountryTests, RulingPartyNotSetForRebel)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("REB",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().setName("test_party").Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(std::nullopt, country->getRulingParty());
 }
@@ -1697,16 +1904,19 @@ TEST(Vic2World_Countries_CountryTests, ActivePartiesDefaultToEmpty)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getActiveParties().empty());
 }
@@ -1720,18 +1930,21 @@ TEST(Vic2World_Countries_CountryTests, ActivePartiesCanBeSet)
 	theStream << "\tactive_party=1\n";
 	theStream << "\tactive_party=3\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().setName("test_party_one").Build(),
 												*Vic2::Party::Builder().setName("test_party_two").Build(),
 												*Vic2::Party::Builder().setName("test_party_three").Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_THAT(country->getActiveParties(),
 		 testing::UnorderedElementsAre(*Vic2::Party::Builder().setName("test_party_one").Build(),
@@ -1750,24 +1963,27 @@ TEST(Vic2World_Countries_CountryTests, ActivePartiesLoggedIfUndefined)
 	theStream << "\tactive_party=1\n";
 	theStream << "\tactive_party=3\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().setName("test_party_one").Build(),
 												*Vic2::Party::Builder().setName("test_party_two").Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 	std::cout.rdbuf(stdOutBuf);
 
 	ASSERT_EQ(
 		 "    [INFO] Determining culture groups\n"
-		 "   [ERROR] Could not open /common/cultures.txt for parsing.\n"
-		 " [WARNING] Party ID mismatch! Did some Vic2 country files not get read?\n",
+		 "   [ERROR] Could not open /common/cultures.txt for parsing.\n",
 		 log.str());
+	ASSERT_THAT(warnings, testing::ElementsAre("Party ID mismatch! Did some Vic2 country files not get read?"));
 	ASSERT_THAT(country->getActiveParties(),
 		 testing::UnorderedElementsAre(*Vic2::Party::Builder().setName("test_party_one").Build()));
 }
@@ -1779,18 +1995,21 @@ TEST(Vic2World_Countries_CountryTests, ActivePartiesCanBecomeRulingPartyIfUnset)
 	theStream << "= {\n";
 	theStream << "\tactive_party=3\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().setName("test_party_one").Build(),
 												*Vic2::Party::Builder().setName("test_party_two").Build(),
 												*Vic2::Party::Builder().setName("test_party_three").Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_NE(std::nullopt, country->getRulingParty());
 	ASSERT_EQ("test_party_three", country->getRulingParty()->getName());
@@ -1803,16 +2022,19 @@ TEST(Vic2World_Countries_CountryTests, LastElectionDefaultsToOneOneOne)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(date("1.1.1"), country->getLastElection());
 }
@@ -1825,16 +2047,19 @@ TEST(Vic2World_Countries_CountryTests, LastElectionCanBeSet)
 	theStream << "\truling_party = 1\n";
 	theStream << "\tlast_election=1942.11.6\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(date("1942.11.6"), country->getLastElection());
 }
@@ -1846,16 +2071,19 @@ TEST(Vic2World_Countries_CountryTests, ShipNamesDefaultToEmpty)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getAllShipNames().empty());
 	ASSERT_TRUE(country->getShipNames("dreadnought").empty());
@@ -1869,11 +2097,13 @@ TEST(Vic2World_Countries_CountryTests, ShipNamesCanBeSet)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder()
 												 .addUnitNames("dreadnought", std::vector<std::string>{"Azerbaijan", "Nader Shah"})
 												 .addUnitNames("ironclad", std::vector<std::string>{"Erivan", "Nakchivan"})
@@ -1881,7 +2111,8 @@ TEST(Vic2World_Countries_CountryTests, ShipNamesCanBeSet)
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_THAT(country->getAllShipNames(),
 		 testing::UnorderedElementsAre(
@@ -1898,16 +2129,19 @@ TEST(Vic2World_Countries_CountryTests, AtWarDefaultsToFalse)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_FALSE(country->isAtWar());
 }
@@ -1919,16 +2153,19 @@ TEST(Vic2World_Countries_CountryTests, AtWarCanBeSet)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	country->setAtWar();
 
 	ASSERT_TRUE(country->isAtWar());
@@ -1941,16 +2178,19 @@ TEST(Vic2World_Countries_CountryTests, WarsDefaultToEmpty)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getWars().empty());
 }
@@ -1962,16 +2202,19 @@ TEST(Vic2World_Countries_CountryTests, WarsCanBeAdded)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	country->addWar(Vic2::War({}));
 
 	ASSERT_FALSE(country->getWars().empty());
@@ -1984,16 +2227,19 @@ TEST(Vic2World_Countries_CountryTests, HasCoreOnCapitalFalseWithNoCores)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_FALSE(country->hasCoreOnCapital());
 }
@@ -2006,16 +2252,19 @@ TEST(Vic2World_Countries_CountryTests, HasCoreOnCapitalFalseWithNoCoreOnCapital)
 	theStream << "\truling_party = 1\n";
 	theStream << "\tcapital = 42\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 	country->addCore(Vic2::Province::Builder().setNumber(43).build());
 
 	ASSERT_FALSE(country->hasCoreOnCapital());
@@ -2029,16 +2278,19 @@ TEST(Vic2World_Countries_CountryTests, HasCoreOnCapitalTrueWithCoreOnCapital)
 	theStream << "\truling_party = 1\n";
 	theStream << "\tcapital = 42\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	country->addCore(Vic2::Province::Builder().setNumber(42).build());
 
 
@@ -2052,16 +2304,19 @@ TEST(Vic2World_Countries_CountryTests, EmployedWorkersDefaultsToZero)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(0, country->getEmployedWorkers());
 }
@@ -2095,16 +2350,19 @@ TEST(Vic2World_Countries_CountryTests, EmployedWorkersComeFromStates)
 	theStream << "\t\t}\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	country->addProvince(1,
 		 Vic2::Province::Builder().setNumber(1).setPops({Pop(PopOptions{.type = "craftsmen", .size = 5})}).build());
 	country->addProvince(2,
@@ -2125,17 +2383,20 @@ TEST(Vic2World_Countries_CountryTests, StateCategoriesCanBeSet)
 	theStream << "\t\tprovinces = { 42 }\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country =
 		 Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 			  *Vic2::StateDefinitions::Builder().setProvinceToIDMap({{42, "TEST_STATE"}}).build(),
 			  Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 			  .createCountry("TAG",
-					theStream,
+					tokenizer,
 					*Vic2::CommonCountryData::Builder().Build(),
 					std::vector{*Vic2::Party::Builder().Build()},
 					*Vic2::StateLanguageCategories::Builder().setCategories({{"TEST_STATE", "TEST_CATEGORY"}}).build(),
 					0.05F,
-					std::nullopt);
+					std::nullopt,
+					warnings);
 
 	ASSERT_EQ(1, country->getStates().size());
 	ASSERT_EQ("TEST_CATEGORY", country->getStates()[0].getLanguageCategory());
@@ -2156,20 +2417,23 @@ TEST(Vic2World_Countries_CountryTests, StateCategoriesLoggedWhenNotSet)
 	auto* stdOutBuf = std::cout.rdbuf();
 	std::cout.rdbuf(log.rdbuf());
 
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().setProvinceToIDMap({{42, "TEST_STATE"}}).build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	std::cout.rdbuf(stdOutBuf);
 
-	ASSERT_THAT(log.str(), testing::HasSubstr(" [WARNING] TEST_STATE was not in any language category.\n"));
+	ASSERT_THAT(warnings, testing::ElementsAre("TEST_STATE was not in any language category."));
 }
 
 
@@ -2179,16 +2443,19 @@ TEST(Vic2World_Countries_CountryTests, IssueSupportDefaultsToZero)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(0, country->getAverageIssueSupport("test_issue"));
 }
@@ -2200,16 +2467,19 @@ TEST(Vic2World_Countries_CountryTests, IssueSupportComesFromProvinces)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	country->addProvince(1,
 		 Vic2::Province::Builder()
 			  .setNumber(1)
@@ -2226,16 +2496,19 @@ TEST(Vic2World_Countries_CountryTests, NameMissingByDefault)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(std::nullopt, country->getName("english"));
 }
@@ -2247,16 +2520,19 @@ TEST(Vic2World_Countries_CountryTests, NameComesFromLocalisations)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	Vic2::LanguageToLocalisationMap nameInLanguages{std::make_pair("english", "Test Country"),
 		 std::make_pair("spanish", "Pais de prueba")};
@@ -2276,16 +2552,19 @@ TEST(Vic2World_Countries_CountryTests, NameCanComeFromDomain)
 	theStream << "\truling_party = 1\n";
 	theStream << "\tdomain_region=\"Test Region\"\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	Vic2::LanguageToLocalisationMap nameInLanguages{std::make_pair("english", "Test Country"),
 		 std::make_pair("spanish", "Pais de prueba")};
@@ -2305,16 +2584,19 @@ TEST(Vic2World_Countries_CountryTests, NameFromDomainUpdatesLocalisations)
 	theStream << "\truling_party = 1\n";
 	theStream << "\tdomain_region=\"Test Region\"\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	Vic2::LanguageToLocalisationMap nameInLanguages{std::make_pair("english", "$REGION$"),
 		 std::make_pair("spanish", "$REGION$")};
@@ -2333,16 +2615,19 @@ TEST(Vic2World_Countries_CountryTests, AdjectiveMissingByDefault)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(std::nullopt, country->getAdjective("english"));
 }
@@ -2354,16 +2639,19 @@ TEST(Vic2World_Countries_CountryTests, AdjectiveComesFromLocalisations)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	Vic2::LanguageToLocalisationMap nameInLanguages{std::make_pair("english", "Testy"),
 		 std::make_pair("spanish",
@@ -2384,16 +2672,19 @@ TEST(Vic2World_Countries_CountryTests, AdjectiveCanComeFromDomain)
 	theStream << "\truling_party = 1\n";
 	theStream << "\tdomain_region=\"Test Region\"\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	Vic2::LanguageToLocalisationMap nameInLanguages{std::make_pair("english", "Testy"),
 		 std::make_pair("spanish",
@@ -2423,16 +2714,19 @@ TEST(Vic2World_Countries_CountryTests, EatCountryAbsorbsStates)
 	theStream << "\t\tprovinces = { 1 }\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *stateDefinitions,
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	std::stringstream theStreamTwo;
 	theStreamTwo << "= {\n";
@@ -2446,16 +2740,18 @@ TEST(Vic2World_Countries_CountryTests, EatCountryAbsorbsStates)
 	theStreamTwo << "\t\tprovinces = { 42 }\n";
 	theStreamTwo << "\t}\n";
 	theStreamTwo << "}";
+	Vic2::SaveTokenizer tokenizerTwo(theStreamTwo.view());
 	const auto countryTwo = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *stateDefinitions,
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 										 .createCountry("TWO",
-											  theStreamTwo,
+											  tokenizerTwo,
 											  *Vic2::CommonCountryData::Builder().Build(),
 											  std::vector{*Vic2::Party::Builder().Build()},
 											  *Vic2::StateLanguageCategories::Builder().build(),
 											  0.05F,
-											  std::nullopt);
+											  std::nullopt,
+											  warnings);
 
 	ASSERT_EQ(1, country->getStates().size());
 	country->eatCountry(*countryTwo, false);
@@ -2472,31 +2768,36 @@ TEST(Vic2World_Countries_CountryTests, EatCountryAbsorbsCores)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	std::stringstream theStreamTwo;
 	theStreamTwo << "= {\n";
 	theStreamTwo << "\truling_party = 1\n";
 	theStreamTwo << "}";
+	Vic2::SaveTokenizer tokenizerTwo(theStreamTwo.view());
 	const auto countryTwo = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 										 .createCountry("TWO",
-											  theStreamTwo,
+											  tokenizerTwo,
 											  *Vic2::CommonCountryData::Builder().Build(),
 											  std::vector{*Vic2::Party::Builder().Build()},
 											  *Vic2::StateLanguageCategories::Builder().build(),
 											  0.05F,
-											  std::nullopt);
+											  std::nullopt,
+											  warnings);
 	countryTwo->addCore(Vic2::Province::Builder().setNumber(1).setCores({"TWO"}).build());
 	countryTwo->addCore(Vic2::Province::Builder().setNumber(2).setCores({"TWO"}).build());
 
@@ -2517,31 +2818,36 @@ TEST(Vic2World_Countries_CountryTests, EatCountryAbsorbsProvinces)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	std::stringstream theStreamTwo;
 	theStreamTwo << "= {\n";
 	theStreamTwo << "\truling_party = 1\n";
 	theStreamTwo << "}";
+	Vic2::SaveTokenizer tokenizerTwo(theStreamTwo.view());
 	const auto countryTwo = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 										 .createCountry("TWO",
-											  theStreamTwo,
+											  tokenizerTwo,
 											  *Vic2::CommonCountryData::Builder().Build(),
 											  std::vector{*Vic2::Party::Builder().Build()},
 											  *Vic2::StateLanguageCategories::Builder().build(),
 											  0.05F,
-											  std::nullopt);
+											  std::nullopt,
+											  warnings);
 
 	const std::shared_ptr<Vic2::Province> provinceOne = Vic2::Province::Builder().setNumber(1).setOwner({"TWO"}).build();
 	const std::shared_ptr<Vic2::Province> provinceTwo = Vic2::Province::Builder().setNumber(2).setOwner({"TWO"}).build();
@@ -2563,16 +2869,19 @@ TEST(Vic2World_Countries_CountryTests, EatCountryAbsorbsTechnologiesAndInvention
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	std::stringstream theStreamTwo;
 	theStreamTwo << "= {\n";
@@ -2582,16 +2891,18 @@ TEST(Vic2World_Countries_CountryTests, EatCountryAbsorbsTechnologiesAndInvention
 	theStreamTwo << "\t\ttechnology_two = {}\n";
 	theStreamTwo << "\t}\n";
 	theStreamTwo << "}";
+	Vic2::SaveTokenizer tokenizerTwo(theStreamTwo.view());
 	const auto countryTwo = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 										 .createCountry("TWO",
-											  theStreamTwo,
+											  tokenizerTwo,
 											  *Vic2::CommonCountryData::Builder().Build(),
 											  std::vector{*Vic2::Party::Builder().Build()},
 											  *Vic2::StateLanguageCategories::Builder().build(),
 											  0.05F,
-											  std::nullopt);
+											  std::nullopt,
+											  warnings);
 
 	ASSERT_TRUE(country->getTechnologiesAndInventions().empty());
 	country->eatCountry(*countryTwo, false);
@@ -2607,16 +2918,19 @@ TEST(Vic2World_Countries_CountryTests, EatCountryAbsorbsArmies)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	std::stringstream theStreamTwo;
 	theStreamTwo << "= {\n";
@@ -2626,16 +2940,18 @@ TEST(Vic2World_Countries_CountryTests, EatCountryAbsorbsArmies)
 	theStreamTwo << "\t\t\tname=\"42nd Army\"\n";
 	theStreamTwo << "\t}\n";
 	theStreamTwo << "}";
+	Vic2::SaveTokenizer tokenizerTwo(theStreamTwo.view());
 	const auto countryTwo = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 										 .createCountry("TWO",
-											  theStreamTwo,
+											  tokenizerTwo,
 											  *Vic2::CommonCountryData::Builder().Build(),
 											  std::vector{*Vic2::Party::Builder().Build()},
 											  *Vic2::StateLanguageCategories::Builder().build(),
 											  0.05F,
-											  std::nullopt);
+											  std::nullopt,
+											  warnings);
 
 	ASSERT_TRUE(country->getArmies().empty());
 	country->eatCountry(*countryTwo, false);
@@ -2651,31 +2967,36 @@ TEST(Vic2World_Countries_CountryTests, EatCountryNoLoggingIfDebugOff)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	std::stringstream theStreamTwo;
 	theStreamTwo << "= {\n";
 	theStreamTwo << "\truling_party = 1\n";
 	theStreamTwo << "}";
+	Vic2::SaveTokenizer tokenizerTwo(theStreamTwo.view());
 	const auto countryTwo = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 										 .createCountry("TWO",
-											  theStreamTwo,
+											  tokenizerTwo,
 											  *Vic2::CommonCountryData::Builder().Build(),
 											  std::vector{*Vic2::Party::Builder().Build()},
 											  *Vic2::StateLanguageCategories::Builder().build(),
 											  0.05F,
-											  std::nullopt);
+											  std::nullopt,
+											  warnings);
 
 	std::stringstream log;
 	auto* stdOutBuf = std::cout.rdbuf();
@@ -2693,31 +3014,36 @@ TEST(Vic2World_Countries_CountryTests, EatCountryLogsIfDebugTrue)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	std::stringstream theStreamTwo;
 	theStreamTwo << "= {\n";
 	theStreamTwo << "\truling_party = 1\n";
 	theStreamTwo << "}";
+	Vic2::SaveTokenizer tokenizerTwo(theStreamTwo.view());
 	const auto countryTwo = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 										 .createCountry("TWO",
-											  theStreamTwo,
+											  tokenizerTwo,
 											  *Vic2::CommonCountryData::Builder().Build(),
 											  std::vector{*Vic2::Party::Builder().Build()},
 											  *Vic2::StateLanguageCategories::Builder().build(),
 											  0.05F,
-											  std::nullopt);
+											  std::nullopt,
+											  warnings);
 
 	std::stringstream log;
 	auto* stdOutBuf = std::cout.rdbuf();
@@ -2738,16 +3064,19 @@ TEST(Vic2World_Countries_CountryTests, EatCountryHasNoEffectOnSelf)
 	theStream << "\t{\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	ASSERT_EQ(1, country->getStates().size());
 	country->eatCountry(*country, false);
@@ -2769,16 +3098,19 @@ TEST(Vic2World_Countries_CountryTests, ProvincesCanBePlacedInStates)
 	theStream << "\t\t}\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 	const std::shared_ptr<Vic2::Province> provinceOne = Vic2::Province::Builder().setNumber(1).build();
 	country->addProvince(1, provinceOne);
 	country->putProvincesInStates();
@@ -2800,16 +3132,19 @@ TEST(Vic2World_Countries_CountryTests, MissingProvinceInStateLogged)
 	theStream << "\t\t}\n";
 	theStream << "\t}\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 							 .createCountry("TAG",
-								  theStream,
+								  tokenizer,
 								  *Vic2::CommonCountryData::Builder().Build(),
 								  std::vector{*Vic2::Party::Builder().Build()},
 								  *Vic2::StateLanguageCategories::Builder().build(),
 								  0.05F,
-								  std::nullopt);
+								  std::nullopt,
+								  warnings);
 
 	std::stringstream log;
 	auto* stdOutBuf = std::cout.rdbuf();
@@ -2827,31 +3162,36 @@ TEST(Vic2World_Countries_CountryTests, SameTagsMakeEqualCountries)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	std::stringstream theStreamTwo;
 	theStreamTwo << "= {\n";
 	theStreamTwo << "\truling_party = 1\n";
 	theStreamTwo << "}";
+	Vic2::SaveTokenizer tokenizerTwo(theStreamTwo.view());
 	const auto countryTwo = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 										 .createCountry("TAG",
-											  theStreamTwo,
+											  tokenizerTwo,
 											  *Vic2::CommonCountryData::Builder().Build(),
 											  std::vector{*Vic2::Party::Builder().Build()},
 											  *Vic2::StateLanguageCategories::Builder().build(),
 											  0.05F,
-											  std::nullopt);
+											  std::nullopt,
+											  warnings);
 
 	ASSERT_EQ(*country, *countryTwo);
 }
@@ -2863,31 +3203,36 @@ TEST(Vic2World_Countries_CountryTests, DifferentTagsMakeUnequalCountries)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	std::stringstream theStreamTwo;
 	theStreamTwo << "= {\n";
 	theStreamTwo << "\truling_party = 1\n";
 	theStreamTwo << "}";
+	Vic2::SaveTokenizer tokenizerTwo(theStreamTwo.view());
 	const auto countryTwo = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 										 .createCountry("TWO",
-											  theStreamTwo,
+											  tokenizerTwo,
 											  *Vic2::CommonCountryData::Builder().Build(),
 											  std::vector{*Vic2::Party::Builder().Build()},
 											  *Vic2::StateLanguageCategories::Builder().build(),
 											  0.05F,
-											  std::nullopt);
+											  std::nullopt,
+											  warnings);
 
 	ASSERT_FALSE(*country == *countryTwo);
 }
@@ -2899,16 +3244,19 @@ TEST(Vic2World_Countries_CountryTests, DynastyDefaultsToNullopt)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(std::nullopt, country->getLastDynasty());
 }
@@ -2920,16 +3268,19 @@ TEST(Vic2World_Countries_CountryTests, MonarchDefaultsToNullopt)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_EQ(std::nullopt, country->getLastMonarch());
 }
@@ -2941,16 +3292,19 @@ TEST(Vic2World_Countries_CountryTests, DynastyImportedFromCountryData)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  *Vic2::CountryData::Builder().setLastDynasty("test_dynasty").Build());
+										  *Vic2::CountryData::Builder().setLastDynasty("test_dynasty").Build(),
+										  warnings);
 
 	ASSERT_EQ("test_dynasty", country->getLastDynasty());
 }
@@ -2962,16 +3316,19 @@ TEST(Vic2World_Countries_CountryTests, MonarchImportedFromCountryData)
 	theStream << "= {\n";
 	theStream << "\truling_party = 1\n";
 	theStream << "}";
+	Vic2::SaveTokenizer tokenizer(theStream.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  theStream,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  *Vic2::CountryData::Builder().setLastMonarch("test_monarch").Build());
+										  *Vic2::CountryData::Builder().setLastMonarch("test_monarch").Build(),
+										  warnings);
 
 	ASSERT_EQ("test_monarch", country->getLastMonarch());
 }
@@ -2981,16 +3338,19 @@ TEST(Vic2World_Countries_CountryTests, GoodsStockpileDefaultsToEmpty)
 {
 	std::stringstream input;
 
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  input,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_TRUE(country->getGoodsStockpile().empty());
 }
@@ -3004,16 +3364,19 @@ TEST(Vic2World_Countries_CountryTests, GoodsStockpileIsReturned)
 	input << "\ttest_good = 4.2\n";
 	input << "}";
 
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
 	const auto country = Vic2::Country::Factory(*Configuration::Builder().setVic2Path("./countries/blank/").build(),
 		 *Vic2::StateDefinitions::Builder().build(),
 		 Vic2::CultureGroups::Factory().getCultureGroups(*Configuration::Builder().build()))
 									 .createCountry("TAG",
-										  input,
+										  tokenizer,
 										  *Vic2::CommonCountryData::Builder().Build(),
 										  std::vector{*Vic2::Party::Builder().Build()},
 										  *Vic2::StateLanguageCategories::Builder().build(),
 										  0.05F,
-										  std::nullopt);
+										  std::nullopt,
+										  warnings);
 
 	ASSERT_THAT(country->getGoodsStockpile(), testing::UnorderedElementsAre(testing::Pair("test_good", 4.2F)));
 }
\ No newline at end of file
@@ -75,6 +75,18 @@ TEST(Vic2World_Localisations_LocalisationsTests, MissingLocalisationsReplacedWit
 }
 
 
+TEST(Vic2World_Localisations_LocalisationsTests, EmptyColumnsAreReplacedWithEnglish)
+{
+	const auto configuration = Configuration::Builder().setVic2Path("./").build();
+	const auto localisations = Vic2::Localisations::Factory().importLocalisations(*configuration);
+
+	ASSERT_EQ("english_partial_loc", localisations->getTextInLanguage("partial_key", "english"));
+	ASSERT_EQ("french_partial_loc", localisations->getTextInLanguage("partial_key", "french"));
+	ASSERT_EQ("english_partial_loc", localisations->getTextInLanguage("partial_key", "german"));
+	ASSERT_EQ("english_partial_loc", localisations->getTextInLanguage("partial_key", "finnish"));
+}
+
+
 TEST(Vic2World_Localisations_LocalisationsTests, TextInAllLanguagesTextInAllLanguages)
 {
 	const auto configuration = Configuration::Builder().setVic2Path("./").build();
@@ -99,6 +111,21 @@ TEST(Vic2World_Localisations_LocalisationsTests, TextInAllLanguagesTextInAllLang
 }
 
 
+TEST(Vic2World_Localisations_LocalisationsTests, TextInAllLanguagesIncludesTextAlreadyLookedUp)
+{
+	const auto configuration = Configuration::Builder().setVic2Path("./").build();
+	const auto localisations = Vic2::Localisations::Factory().importLocalisations(*configuration);
+
+	ASSERT_EQ("french_loc", localisations->getTextInLanguage("test_key", "french"));
+	const auto textInEachLanguage = localisations->getTextInEachLanguage("test_key");
+
+	ASSERT_EQ(13, textInEachLanguage.size());
+	ASSERT_EQ("english_loc", textInEachLanguage.at("english"));
+	ASSERT_EQ("french_loc", textInEachLanguage.at("french"));
+	ASSERT_EQ("finnish_loc", textInEachLanguage.at("finnish"));
+}
+
+
 TEST(Vic2World_Localisations_LocalisationsTests, LocalisationsCanBeLoadedFromMod)
 {
 	const auto configuration =
@@ -121,6 +148,21 @@ TEST(Vic2World_Localisations_LocalisationsTests, LocalisationsCanBeLoadedFromMod
 }
 
 
+TEST(Vic2World_Localisations_LocalisationsTests, ModLocalisationsOverrideBaseLocalisations)
+{
+	const auto baseConfiguration = Configuration::Builder().setVic2Path("./").build();
+	const auto baseLocalisations = Vic2::Localisations::Factory().importLocalisations(*baseConfiguration);
+	const auto modConfiguration =
+		 Configuration::Builder().setVic2Path("./").addVic2Mod(Mod("Mod Locs", "modLocalisations/")).build();
+	const auto modLocalisations = Vic2::Localisations::Factory().importLocalisations(*modConfiguration);
+
+	ASSERT_EQ("english_base_loc", baseLocalisations->getTextInLanguage("override_key", "english"));
+	ASSERT_EQ("french_base_loc", baseLocalisations->getTextInLanguage("override_key", "french"));
+	ASSERT_EQ("english_mod_loc", modLocalisations->getTextInLanguage("override_key", "english"));
+	ASSERT_EQ("english_mod_loc", modLocalisations->getTextInLanguage("override_key", "french"));
+}
+
+
 TEST(Vic2World_Localisations_LocalisationsTests, LocalisationsCanBeLoadedFromConverter)
 {
 	const auto configuration = Configuration::Builder().setVic2Path("./").build();
@@ -207,4 +249,35 @@ TEST(Vic2World_Localisations_LocalisationsTests, UpdateDomainCountrySkipsMissing
 	auto localisations = Vic2::Localisations::Factory().importLocalisations(*configuration);
 
 	ASSERT_NO_THROW(localisations->updateDomainCountry("NON", "Replacement Region English"));
-}
\ No newline at end of file
+}
+
+
+TEST(Vic2World_Localisations_LocalisationsTests, ReplacementRegionTextCanBeFromModBeforeAnyLookup)
+{
+	const auto configuration =
+		 Configuration::Builder().setVic2Path("./").addVic2Mod(Mod("Mod Locs", "modLocalisations/")).build();
+	auto localisations = Vic2::Localisations::Factory().importLocalisations(*configuration);
+	localisations->updateDomainCountry("TAG", "Mod Region English");
+
+	ASSERT_EQ("Localisation for Mod Region English replacement English",
+		 localisations->getTextInLanguage("TAG", "english"));
+	ASSERT_EQ("Localisation for Mod Region French replacement French",
+		 localisations->getTextInLanguage("TAG", "french"));
+	ASSERT_EQ("Localisation for Mod Region English replacement German",
+		 localisations->getTextInLanguage("TAG", "german"));
+}
+
+
+TEST(Vic2World_Localisations_LocalisationsTests, RegionTextCanBeReplacedAfterLookup)
+{
+	const auto configuration = Configuration::Builder().setVic2Path("./").build();
+	auto localisations = Vic2::Localisations::Factory().importLocalisations(*configuration);
+
+	ASSERT_EQ("Localisation for $REGION$ replacement English", localisations->getTextInLanguage("TAG", "english"));
+	localisations->updateDomainCountry("TAG", "Replacement Region English");
+
+	ASSERT_EQ("Localisation for Replacement Region English replacement English",
+		 localisations->getTextInLanguage("TAG", "english"));
+	ASSERT_EQ("Localisation for Replacement Region French replacement French",
+		 localisations->getTextInLanguage("TAG", "french"));
+}
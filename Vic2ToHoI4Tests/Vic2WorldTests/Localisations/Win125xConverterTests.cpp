@@ -0,0 +1,46 @@
+#include "V2World/Localisations/Win125xConverter.h"
+#include "gtest/gtest.h"
+
+
+
+TEST(Vic2World_Localisations_Win125xConverterTests, AsciiIsUnchanged)
+{
+	EXPECT_EQ(Vic2::convertWin125xToUtf8("", Vic2::Encoding::Win1252), "");
+	EXPECT_EQ(Vic2::convertWin125xToUtf8("short", Vic2::Encoding::Win1252), "short");
+	EXPECT_EQ(Vic2::convertWin125xToUtf8("a somewhat longer line of plain ascii text", Vic2::Encoding::Win1250),
+		 "a somewhat longer line of plain ascii text");
+}
+
+
+TEST(Vic2World_Localisations_Win125xConverterTests, Win1252IsConverted)
+{
+	EXPECT_EQ(Vic2::convertWin125xToUtf8("\xE9\x80\xDF", Vic2::Encoding::Win1252), "é€ß");
+}
+
+
+TEST(Vic2World_Localisations_Win125xConverterTests, Win1250IsConverted)
+{
+	EXPECT_EQ(Vic2::convertWin125xToUtf8("\xA3\xF3\x9F", Vic2::Encoding::Win1250), "Łóź");
+}
+
+
+TEST(Vic2World_Localisations_Win125xConverterTests, Win1251IsConverted)
+{
+	EXPECT_EQ(Vic2::convertWin125xToUtf8("\xD0\xEE\xF1\xF1\xE8\xFF", Vic2::Encoding::Win1251),
+		 "Россия");
+}
+
+
+TEST(Vic2World_Localisations_Win125xConverterTests, UndefinedBytesBecomeControlCharacters)
+{
+	EXPECT_EQ(Vic2::convertWin125xToUtf8("\x81", Vic2::Encoding::Win1252), "\u0081");
+	EXPECT_EQ(Vic2::convertWin125xToUtf8("\x98", Vic2::Encoding::Win1251), "\u0098");
+}
+
+
+TEST(Vic2World_Localisations_Win125xConverterTests, ConvertedBytesCanFollowLongAsciiRuns)
+{
+	EXPECT_EQ(Vic2::convertWin125xToUtf8("sixteen ascii ch\xE9 and then more than sixteen again \xE8",
+					 Vic2::Encoding::Win1252),
+		 "sixteen ascii ché and then more than sixteen again è");
+}
@@ -1,5 +1,6 @@
 #include "V2World/Military/Army.h"
 #include "V2World/Military/ArmyFactory.h"
+#include "gmock/gmock-matchers.h"
 #include "gtest/gtest.h"
 #include <sstream>
 
@@ -8,7 +9,8 @@
 TEST(Vic2World_Military_ArmyTests, NameDefaultsToEmpty)
 {
 	std::stringstream input;
-	const auto army = Vic2::Army::Factory().getArmy("", input);
+	std::vector<std::string> warnings;
+	const auto army = Vic2::Army::Factory().getArmy("", input, warnings);
 
 	ASSERT_TRUE(army->getName().empty());
 }
@@ -20,7 +22,8 @@ TEST(Vic2World_Military_ArmyTests, NameCanBeSet)
 	input << "= {\n";
 	input << "\tname = test_name\n";
 	input << "}";
-	const auto army = Vic2::Army::Factory().getArmy("", input);
+	std::vector<std::string> warnings;
+	const auto army = Vic2::Army::Factory().getArmy("", input, warnings);
 
 	ASSERT_EQ("test_name", army->getName());
 }
@@ -32,7 +35,8 @@ TEST(Vic2World_Military_ArmyTests, OwnerIsAsSet)
 	input << "= {\n";
 	input << "\tname = test_name\n";
 	input << "}";
-	const auto army = Vic2::Army::Factory().getArmy("TAG", input);
+	std::vector<std::string> warnings;
+	const auto army = Vic2::Army::Factory().getArmy("TAG", input, warnings);
 
 	ASSERT_EQ("TAG", army->getOwner());
 }
@@ -45,14 +49,11 @@ TEST(Vic2World_Military_ArmyTests, LocationDefaultsToNullopt)
 	input << "\tname = test_name\n";
 	input << "}";
 
-	const std::stringstream log;
-	auto* stdOutBuf = std::cout.rdbuf();
-	std::cout.rdbuf(log.rdbuf());
-	const auto army = Vic2::Army::Factory().getArmy("", input);
-	std::cout.rdbuf(stdOutBuf);
+	std::vector<std::string> warnings;
+	const auto army = Vic2::Army::Factory().getArmy("", input, warnings);
 
 	ASSERT_FALSE(army->getLocation());
-	ASSERT_EQ(" [WARNING] Army or Navy test_name has no location\n", log.str());
+	ASSERT_THAT(warnings, testing::ElementsAre("Army or Navy test_name has no location"));
 }
 
 
@@ -62,7 +63,8 @@ TEST(Vic2World_Military_ArmyTests, LocationCanBeSet)
 	input << "= {\n";
 	input << "\tlocation = 42\n";
 	input << "}";
-	const auto army = Vic2::Army::Factory().getArmy("", input);
+	std::vector<std::string> warnings;
+	const auto army = Vic2::Army::Factory().getArmy("", input, warnings);
 
 	ASSERT_EQ(42, army->getLocation());
 }
@@ -74,7 +76,8 @@ TEST(Vic2World_Military_ArmyTests, LocationCanBeChanged)
 	input << "= {\n";
 	input << "\tlocation = 42\n";
 	input << "}";
-	auto army = Vic2::Army::Factory().getArmy("", input);
+	std::vector<std::string> warnings;
+	auto army = Vic2::Army::Factory().getArmy("", input, warnings);
 	army->setLocation(144);
 
 	ASSERT_EQ(144, army->getLocation());
@@ -84,7 +87,8 @@ TEST(Vic2World_Military_ArmyTests, LocationCanBeChanged)
 TEST(Vic2World_Military_ArmyTests, UnitsDefaultsToEmpty)
 {
 	std::stringstream input;
-	const auto army = Vic2::Army::Factory().getArmy("", input);
+	std::vector<std::string> warnings;
+	const auto army = Vic2::Army::Factory().getArmy("", input, warnings);
 
 	ASSERT_TRUE(army->getUnits().empty());
 }
@@ -101,7 +105,8 @@ TEST(Vic2World_Military_ArmyTests, UnitsCanBeAdded)
 	input << "\t\tname = test_ship\n";
 	input << "\t}\n";
 	input << "}";
-	const auto army = Vic2::Army::Factory().getArmy("", input);
+	std::vector<std::string> warnings;
+	const auto army = Vic2::Army::Factory().getArmy("", input, warnings);
 
 	ASSERT_EQ(2, army->getUnits().size());
 	ASSERT_EQ("test_regiment", army->getUnits()[0].getName());
@@ -112,7 +117,8 @@ TEST(Vic2World_Military_ArmyTests, UnitsCanBeAdded)
 TEST(Vic2World_Military_ArmyTests, TransportedArmiesDefaultsToEmpty)
 {
 	std::stringstream input;
-	const auto army = Vic2::Army::Factory().getArmy("", input);
+	std::vector<std::string> warnings;
+	const auto army = Vic2::Army::Factory().getArmy("", input, warnings);
 
 	ASSERT_TRUE(army->getTransportedArmies().empty());
 }
@@ -128,7 +134,8 @@ TEST(Vic2World_Military_ArmyTests, TransportedArmiesCanBeAdded)
 	input << "\t\t}\n";
 	input << "\t}\n";
 	input << "}";
-	const auto army = Vic2::Army::Factory().getArmy("", input);
+	std::vector<std::string> warnings;
+	const auto army = Vic2::Army::Factory().getArmy("", input, warnings);
 
 	ASSERT_EQ(1, army->getTransportedArmies().size());
 	ASSERT_EQ(1, army->getTransportedArmies()[0].getUnits().size());
@@ -1,5 +1,6 @@
 #include "V2World/Military/Unit.h"
 #include "V2World/Military/UnitFactory.h"
+#include "gmock/gmock-matchers.h"
 #include "gtest/gtest.h"
 #include <sstream>
 
@@ -8,7 +9,8 @@
 TEST(Vic2World_Military_UnitTests, NameDefaultsToEmpty)
 {
 	std::stringstream input;
-	const auto unit = Vic2::Unit::Factory().getUnit(input);
+	std::vector<std::string> warnings;
+	const auto unit = Vic2::Unit::Factory().getUnit(input, warnings);
 
 	ASSERT_TRUE(unit->getName().empty());
 }
@@ -20,7 +22,8 @@ TEST(Vic2World_Military_UnitTests, NameCanBeSet)
 	input << "= {\n";
 	input << "\tname = test_name\n";
 	input << "}";
-	const auto unit = Vic2::Unit::Factory().getUnit(input);
+	std::vector<std::string> warnings;
+	const auto unit = Vic2::Unit::Factory().getUnit(input, warnings);
 
 	ASSERT_EQ("test_name", unit->getName());
 }
@@ -33,14 +36,11 @@ TEST(Vic2World_Military_UnitTests, TypeDefaultsToEmpty)
 	input << "\tname = test_name\n";
 	input << "}";
 
-	const std::stringstream log;
-	auto* stdOutBuf = std::cout.rdbuf();
-	std::cout.rdbuf(log.rdbuf());
-	const auto unit = Vic2::Unit::Factory().getUnit(input);
-	std::cout.rdbuf(stdOutBuf);
+	std::vector<std::string> warnings;
+	const auto unit = Vic2::Unit::Factory().getUnit(input, warnings);
 
 	ASSERT_TRUE(unit->getType().empty());
-	ASSERT_EQ(" [WARNING] Regiment or Ship test_name has no type\n", log.str());
+	ASSERT_THAT(warnings, testing::ElementsAre("Regiment or Ship test_name has no type"));
 }
 
 
@@ -50,7 +50,8 @@ TEST(Vic2World_Military_UnitTests, TypeCanBeSet)
 	input << "= {\n";
 	input << "\ttype = test_type\n";
 	input << "}";
-	const auto unit = Vic2::Unit::Factory().getUnit(input);
+	std::vector<std::string> warnings;
+	const auto unit = Vic2::Unit::Factory().getUnit(input, warnings);
 
 	ASSERT_EQ("test_type", unit->getType());
 }
@@ -59,7 +60,8 @@ TEST(Vic2World_Military_UnitTests, TypeCanBeSet)
 TEST(Vic2World_Military_UnitTests, StrengthDefaultsToZero)
 {
 	std::stringstream input;
-	const auto unit = Vic2::Unit::Factory().getUnit(input);
+	std::vector<std::string> warnings;
+	const auto unit = Vic2::Unit::Factory().getUnit(input, warnings);
 
 	ASSERT_EQ(0.0, unit->getStrength());
 }
@@ -71,7 +73,8 @@ TEST(Vic2World_Military_UnitTests, StrengthCanBeSet)
 	input << "= {\n";
 	input << "\tstrength = 4.200\n";
 	input << "}";
-	const auto unit = Vic2::Unit::Factory().getUnit(input);
+	std::vector<std::string> warnings;
+	const auto unit = Vic2::Unit::Factory().getUnit(input, warnings);
 
 	ASSERT_NEAR(4.2, unit->getStrength(), 0.0001);
 }
@@ -80,7 +83,8 @@ TEST(Vic2World_Military_UnitTests, StrengthCanBeSet)
 TEST(Vic2World_Military_UnitTests, OrganizationDefaultsToZero)
 {
 	std::stringstream input;
-	const auto unit = Vic2::Unit::Factory().getUnit(input);
+	std::vector<std::string> warnings;
+	const auto unit = Vic2::Unit::Factory().getUnit(input, warnings);
 
 	ASSERT_EQ(0.0, unit->getOrganization());
 }
@@ -92,7 +96,8 @@ TEST(Vic2World_Military_UnitTests, OrganizationCanBeSet)
 	input << "= {\n";
 	input << "\torganisation = 42.00\n";
 	input << "}";
-	const auto unit = Vic2::Unit::Factory().getUnit(input);
+	std::vector<std::string> warnings;
+	const auto unit = Vic2::Unit::Factory().getUnit(input, warnings);
 
 	ASSERT_NEAR(42.0, unit->getOrganization(), 0.0001);
 }
@@ -101,7 +106,8 @@ TEST(Vic2World_Military_UnitTests, OrganizationCanBeSet)
 TEST(Vic2World_Military_UnitTests, ExperienceDefaultsToZero)
 {
 	std::stringstream input;
-	const auto unit = Vic2::Unit::Factory().getUnit(input);
+	std::vector<std::string> warnings;
+	const auto unit = Vic2::Unit::Factory().getUnit(input, warnings);
 
 	ASSERT_EQ(0.0, unit->getExperience());
 }
@@ -113,7 +119,8 @@ TEST(Vic2World_Military_UnitTests, ExperienceCanBeSet)
 	input << "= {\n";
 	input << "\texperience = 0.42\n";
 	input << "}";
-	const auto unit = Vic2::Unit::Factory().getUnit(input);
+	std::vector<std::string> warnings;
+	const auto unit = Vic2::Unit::Factory().getUnit(input, warnings);
 
 	ASSERT_NEAR(0.42, unit->getExperience(), 0.0001);
 }
\ No newline at end of file
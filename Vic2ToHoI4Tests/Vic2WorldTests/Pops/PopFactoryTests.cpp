@@ -1,5 +1,6 @@
 #include "V2World/Issues/IssuesBuilder.h"
 #include "V2World/Pops/PopFactory.h"
+#include "gmock/gmock-matchers.h"
 #include "gtest/gtest.h"
 #include <sstream>
 
@@ -18,7 +19,9 @@ class Vic2World_Pops_PopFactoryTests: public testing::Test
 TEST_F(Vic2World_Pops_PopFactoryTests, DefaultsAreSet)
 {
 	std::stringstream input;
-	const auto pop = popFactory.getPop("test_type", input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto pop = popFactory.getPop("test_type", tokenizer, warnings);
 
 	EXPECT_EQ("test_type", pop.getType());
 	EXPECT_EQ("no_culture", pop.getCulture());
@@ -34,7 +37,9 @@ TEST_F(Vic2World_Pops_PopFactoryTests, CultureCanBeSet)
 	input << "{\n";
 	input << "\ttest_culture=test_religion\n";
 	input << "}";
-	const auto pop = popFactory.getPop("test_type", input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto pop = popFactory.getPop("test_type", tokenizer, warnings);
 
 	EXPECT_EQ("test_culture", pop.getCulture());
 }
@@ -46,7 +51,9 @@ TEST_F(Vic2World_Pops_PopFactoryTests, CultureIsNotSetToCon)
 	input << "{\n";
 	input << "\tcon=whatever\n";
 	input << "}";
-	const auto pop = popFactory.getPop("test_type", input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto pop = popFactory.getPop("test_type", tokenizer, warnings);
 
 	EXPECT_EQ("no_culture", pop.getCulture());
 }
@@ -58,7 +65,9 @@ TEST_F(Vic2World_Pops_PopFactoryTests, CultureIsNotSetToId)
 	input << "{\n";
 	input << "\tid=whatever\n";
 	input << "}";
-	const auto pop = popFactory.getPop("test_type", input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto pop = popFactory.getPop("test_type", tokenizer, warnings);
 
 	EXPECT_EQ("no_culture", pop.getCulture());
 }
@@ -71,7 +80,9 @@ TEST_F(Vic2World_Pops_PopFactoryTests, CultureIsOnlySetOnce)
 	input << "\ttest_culture=test_religion\n";
 	input << "\ttest_culture_two=test_religion_two\n";
 	input << "}";
-	const auto pop = popFactory.getPop("test_type", input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto pop = popFactory.getPop("test_type", tokenizer, warnings);
 
 	EXPECT_EQ("test_culture", pop.getCulture());
 }
@@ -83,7 +94,9 @@ TEST_F(Vic2World_Pops_PopFactoryTests, SizecanBeSet)
 	input << "{\n";
 	input << "\tsize=12345\n";
 	input << "}";
-	const auto pop = popFactory.getPop("test_type", input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto pop = popFactory.getPop("test_type", tokenizer, warnings);
 
 	EXPECT_EQ(12345, pop.getSize());
 }
@@ -95,7 +108,9 @@ TEST_F(Vic2World_Pops_PopFactoryTests, LiteracyCanBeSet)
 	input << "{\n";
 	input << "\tliteracy=0.42\n";
 	input << "}";
-	const auto pop = popFactory.getPop("test_type", input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto pop = popFactory.getPop("test_type", tokenizer, warnings);
 
 	EXPECT_DOUBLE_EQ(0.42, pop.getLiteracy());
 }
@@ -107,7 +122,9 @@ TEST_F(Vic2World_Pops_PopFactoryTests, MilitancyCanBeSet)
 	input << "{\n";
 	input << "\tmil=0.42\n";
 	input << "}";
-	const auto pop = popFactory.getPop("test_type", input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto pop = popFactory.getPop("test_type", tokenizer, warnings);
 
 	EXPECT_DOUBLE_EQ(0.42, pop.getMilitancy());
 }
@@ -122,15 +139,11 @@ TEST_F(Vic2World_Pops_PopFactoryTests, IssueWithNonIntegerIssueNumberLogsWarning
 	input << "\t}\n";
 	input << "}";
 
-	const std::stringstream log;
-	auto* const stdOutBuf = std::cout.rdbuf();
-	std::cout.rdbuf(log.rdbuf());
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto pop = popFactory.getPop("test_type", tokenizer, warnings);
 
-	const auto pop = popFactory.getPop("test_type", input);
-
-	std::cout.rdbuf(stdOutBuf);
-
-	EXPECT_EQ(" [WARNING] Poorly formatted pop issue: not_an_int=87.125\n", log.str());
+	EXPECT_THAT(warnings, testing::ElementsAre("Poorly formatted pop issue: not_an_int=87.125"));
 }
 
 
@@ -143,15 +156,11 @@ TEST_F(Vic2World_Pops_PopFactoryTests, IssueWithNonFloatIssueSupportLogsWarning)
 	input << "\t}\n";
 	input << "}";
 
-	const std::stringstream log;
-	auto* const stdOutBuf = std::cout.rdbuf();
-	std::cout.rdbuf(log.rdbuf());
-
-	const auto pop = popFactory.getPop("test_type", input);
-
-	std::cout.rdbuf(stdOutBuf);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto pop = popFactory.getPop("test_type", tokenizer, warnings);
 
-	EXPECT_EQ(" [WARNING] Poorly formatted pop issue: 42=not_a_float\n", log.str());
+	EXPECT_THAT(warnings, testing::ElementsAre("Poorly formatted pop issue: 42=not_a_float"));
 }
 
 
@@ -163,8 +172,10 @@ TEST(Vic2World_Pops_PopTests, IssuesCanBeImported)
 	input << "1=87.125\n";
 	input << "\t}";
 	input << "}";
-	const auto pop =
-		 Vic2::PopFactory(*Vic2::Issues::Builder().addIssueName("learn_the_question").build()).getPop("", input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto pop = Vic2::PopFactory(*Vic2::Issues::Builder().addIssueName("learn_the_question").build())
+								 .getPop("", tokenizer, warnings);
 
 	EXPECT_FLOAT_EQ(87.125F, pop.getIssueSupport("learn_the_question"));
 }
\ No newline at end of file
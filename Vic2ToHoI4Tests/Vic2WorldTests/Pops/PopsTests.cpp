@@ -0,0 +1,110 @@
+#include "V2World/Pops/Pops.h"
+#include "gtest/gtest.h"
+
+
+
+using Vic2::Pop;
+using Vic2::PopOptions;
+using Vic2::Pops;
+
+
+
+TEST(Vic2World_Pops_PopsTests, PopsDefaultToEmpty)
+{
+	const Pops pops;
+
+	EXPECT_TRUE(pops.empty());
+	EXPECT_EQ(pops.size(), 0);
+	EXPECT_EQ(pops.begin(), pops.end());
+}
+
+
+TEST(Vic2World_Pops_PopsTests, PopsCanBeReadBack)
+{
+	const Pops pops({Pop(PopOptions{.type = "farmers",
+							  .culture = "test_culture",
+							  .size = 42,
+							  .literacy = 0.5,
+							  .militancy = 1.5}),
+		 Pop(PopOptions{.type = "clerks", .size = 7})});
+
+	ASSERT_EQ(pops.size(), 2);
+	EXPECT_EQ(pops[0].getType(), "farmers");
+	EXPECT_EQ(pops[0].getCulture(), "test_culture");
+	EXPECT_EQ(pops[0].getSize(), 42);
+	EXPECT_DOUBLE_EQ(pops[0].getLiteracy(), 0.5);
+	EXPECT_DOUBLE_EQ(pops[0].getMilitancy(), 1.5);
+	EXPECT_EQ(pops[1].getType(), "clerks");
+	EXPECT_EQ(pops[1].getCulture(), "no_culture");
+	EXPECT_EQ(pops[1].getSize(), 7);
+}
+
+
+TEST(Vic2World_Pops_PopsTests, IssuesStayWithTheirPops)
+{
+	Pops pops;
+	pops.push_back(Pop(PopOptions{.popIssues{{"first_issue", 1.0F}, {"second_issue", 2.0F}}}));
+	pops.push_back(Pop());
+	pops.push_back(Pop(PopOptions{.popIssues{{"second_issue", 3.0F}}}));
+
+	EXPECT_FLOAT_EQ(pops[0].getIssueSupport("first_issue"), 1.0F);
+	EXPECT_FLOAT_EQ(pops[0].getIssueSupport("second_issue"), 2.0F);
+	EXPECT_FLOAT_EQ(pops[1].getIssueSupport("first_issue"), 0.0F);
+	EXPECT_FLOAT_EQ(pops[2].getIssueSupport("first_issue"), 0.0F);
+	EXPECT_FLOAT_EQ(pops[2].getIssueSupport("second_issue"), 3.0F);
+}
+
+
+TEST(Vic2World_Pops_PopsTests, PopsCanBeIterated)
+{
+	const Pops pops({Pop(PopOptions{.size = 1}), Pop(PopOptions{.size = 2}), Pop(PopOptions{.size = 3})});
+
+	auto total = 0;
+	for (const auto& pop: pops)
+	{
+		total += pop.getSize();
+	}
+	EXPECT_EQ(total, 6);
+}
+
+
+TEST(Vic2World_Pops_PopsTests, TotalsAreKeptByTypeAndCulture)
+{
+	const Pops pops({Pop(PopOptions{.type = "farmers", .culture = "test_culture", .size = 100, .literacy = 1.0}),
+		 Pop(PopOptions{.type = "farmers", .culture = "other_culture", .size = 50}),
+		 Pop(PopOptions{.type = "clerks", .culture = "test_culture", .size = 10})});
+
+	EXPECT_EQ(pops.getPopulation(), 160);
+	EXPECT_EQ(pops.getPopulation(*Vic2::findPopName("farmers")), 150);
+	EXPECT_EQ(pops.getPopulation(*Vic2::findPopName("clerks")), 10);
+	EXPECT_EQ(pops.getPopulation(Vic2::internPopName("aristocrats")), 0);
+	EXPECT_EQ(pops.getLiteracyWeightedPopulation(*Vic2::findPopName("farmers")), 105);
+
+	auto testCulturePopulation = 0;
+	for (const auto& [culture, population]: pops.getCultureTotals())
+	{
+		if (culture == *Vic2::findPopName("test_culture"))
+		{
+			testCulturePopulation += population;
+		}
+	}
+	EXPECT_EQ(testCulturePopulation, 110);
+}
+
+
+TEST(Vic2World_Pops_PopsTests, IssueTotalsAreWeightedBySize)
+{
+	const Pops pops({Pop(PopOptions{.size = 10, .popIssues{{"test_issue", 0.5F}}}),
+		 Pop(PopOptions{.size = 30, .popIssues{{"test_issue", 0.25F}, {"other_issue", 1.0F}}})});
+
+	const auto testIssue = *Vic2::findPopName("test_issue");
+	auto testIssueSupport = 0.0;
+	for (const auto& [issue, weightedSupport]: pops.getIssueTotals())
+	{
+		if (issue == testIssue)
+		{
+			testIssueSupport = weightedSupport;
+		}
+	}
+	EXPECT_DOUBLE_EQ(testIssueSupport, 12.5);
+}
@@ -31,7 +31,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, numberCanBeSet)
 	input << "{\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getNumber(), 42);
 }
@@ -44,7 +46,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, isLandDefaultsToFalse)
 	input << "{\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 	ASSERT_FALSE(theProvince->isLandProvince());
 }
 
@@ -57,7 +61,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, isLandTrueWhenLifeRatingExists)
 	input << "\tlife_rating=35\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 	ASSERT_TRUE(theProvince->isLandProvince());
 }
 
@@ -69,7 +75,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, ownerDefaultsToBlank)
 	input << "{\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getOwner(), "");
 }
@@ -83,7 +91,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, ownerCanBeSet)
 	input << "\towner=\"TAG\"";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getOwner(), "TAG");
 }
@@ -96,7 +106,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, controllerDefaultsToBlank)
 	input << "{\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getController(), "");
 }
@@ -110,7 +122,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, controllerCanBeSet)
 	input << "\tcontroller=\"TAG\"";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getController(), "TAG");
 }
@@ -123,7 +137,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, coresDefaultToEmpty)
 	input << "{\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getCores().size(), 0);
 }
@@ -138,7 +154,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, coresCanBeSet)
 	input << "\tcore=\"2ND\"";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getCores().size(), 2);
 	ASSERT_TRUE(theProvince->getCores().contains("TAG"));
@@ -153,7 +171,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, popsDefaultToEmpty)
 	input << "{\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getPops().size(), 0);
 }
@@ -168,7 +188,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, aristocratsCanBeAddedToPops)
 	input << "\t}\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getPops().size(), 1);
 	ASSERT_EQ(theProvince->getPops()[0].getType(), "aristocrats");
@@ -184,7 +206,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, artisansCanBeAddedToPops)
 	input << "\t}\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getPops().size(), 1);
 	ASSERT_EQ(theProvince->getPops()[0].getType(), "artisans");
@@ -200,7 +224,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, bureaucratsCanBeAddedToPops)
 	input << "\t}\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getPops().size(), 1);
 	ASSERT_EQ(theProvince->getPops()[0].getType(), "bureaucrats");
@@ -216,7 +242,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, capitalistsCanBeAddedToPops)
 	input << "\t}\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getPops().size(), 1);
 	ASSERT_EQ(theProvince->getPops()[0].getType(), "capitalists");
@@ -232,7 +260,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, clergymenCanBeAddedToPops)
 	input << "\t}\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getPops().size(), 1);
 	ASSERT_EQ(theProvince->getPops()[0].getType(), "clergymen");
@@ -248,7 +278,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, craftsmenCanBeAddedToPops)
 	input << "\t}\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getPops().size(), 1);
 	ASSERT_EQ(theProvince->getPops()[0].getType(), "craftsmen");
@@ -264,7 +296,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, clerksCanBeAddedToPops)
 	input << "\t}\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getPops().size(), 1);
 	ASSERT_EQ(theProvince->getPops()[0].getType(), "clerks");
@@ -280,7 +314,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, farmersCanBeAddedToPops)
 	input << "\t}\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getPops().size(), 1);
 	ASSERT_EQ(theProvince->getPops()[0].getType(), "farmers");
@@ -296,7 +332,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, soldiersCanBeAddedToPops)
 	input << "\t}\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getPops().size(), 1);
 	ASSERT_EQ(theProvince->getPops()[0].getType(), "soldiers");
@@ -312,7 +350,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, officersCanBeAddedToPops)
 	input << "\t}\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getPops().size(), 1);
 	ASSERT_EQ(theProvince->getPops()[0].getType(), "officers");
@@ -328,7 +368,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, labourersCanBeAddedToPops)
 	input << "\t}\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getPops().size(), 1);
 	ASSERT_EQ(theProvince->getPops()[0].getType(), "labourers");
@@ -344,7 +386,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, slavesCanBeAddedToPops)
 	input << "\t}\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getPops().size(), 1);
 	ASSERT_EQ(theProvince->getPops()[0].getType(), "slaves");
@@ -360,7 +404,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, serfsCanBeAddedToPops)
 	input << "\t}\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getPops().size(), 1);
 	ASSERT_EQ(theProvince->getPops()[0].getType(), "serfs");
@@ -374,7 +420,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, navalBaseLevelDefaultsToZero)
 	input << "{\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getNavalBaseLevel(), 0);
 }
@@ -390,7 +438,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, navalBaseLevelCanBeSet)
 	input << "  6.000 6.000 }\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getNavalBaseLevel(), 6);
 }
@@ -403,7 +453,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, railLevelDefaultsToZero)
 	input << "{\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getRailLevel(), 0);
 }
@@ -419,7 +471,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, railLevelCanBeSet)
 	input << "  5.000 5.000 }\n";
 	input << "}";
 
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	ASSERT_EQ(theProvince->getRailLevel(), 5);
 }
@@ -428,7 +482,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, railLevelCanBeSet)
 TEST_F(Vic2World_ProvinceFactoryTests, FlagsDefaultToEmpty)
 {
 	std::stringstream input;
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	EXPECT_TRUE(theProvince->getFlags().empty());
 }
@@ -441,7 +497,9 @@ TEST_F(Vic2World_ProvinceFactoryTests, FlagsCanBeSet)
 	input << "\tflag_one=yes\n";
 	input << "\tflag_two=no\n";
 	input << "}";
-	const auto theProvince = provinceFactory->getProvince(42, input);
+	Vic2::SaveTokenizer tokenizer(input.view());
+	std::vector<std::string> warnings;
+	const auto theProvince = provinceFactory->getProvince(42, tokenizer, warnings);
 
 	EXPECT_THAT(theProvince->getFlags(), testing::UnorderedElementsAre("flag_one", "flag_two"));
 }
\ No newline at end of file
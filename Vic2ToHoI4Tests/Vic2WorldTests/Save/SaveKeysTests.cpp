@@ -0,0 +1,83 @@
+#include "V2World/Save/SaveKeys.h"
+#include "gtest/gtest.h"
+
+
+
+TEST(Vic2World_Save_SaveKeysTests, DigitRunsAreProvinceNumbers)
+{
+	EXPECT_TRUE(Vic2::isProvinceNumber("1"));
+	EXPECT_TRUE(Vic2::isProvinceNumber("3291"));
+	EXPECT_FALSE(Vic2::isProvinceNumber(""));
+	EXPECT_FALSE(Vic2::isProvinceNumber("12a"));
+	EXPECT_FALSE(Vic2::isProvinceNumber("-1"));
+}
+
+
+TEST(Vic2World_Save_SaveKeysTests, CountryTagsAreRecognized)
+{
+	EXPECT_TRUE(Vic2::isCountryTag("TAG"));
+	EXPECT_TRUE(Vic2::isCountryTag("D01"));
+	EXPECT_FALSE(Vic2::isCountryTag("1AB"));
+	EXPECT_FALSE(Vic2::isCountryTag("tag"));
+	EXPECT_FALSE(Vic2::isCountryTag("TA"));
+	EXPECT_FALSE(Vic2::isCountryTag("TAGS"));
+}
+
+
+TEST(Vic2World_Save_SaveKeysTests, KeywordsCanBeFound)
+{
+	const Vic2::KeywordTable<int> keywords{{"owner", 1}, {"core", 2}, {"controller", 3}};
+
+	EXPECT_EQ(keywords.find("owner"), 1);
+	EXPECT_EQ(keywords.find("core"), 2);
+	EXPECT_EQ(keywords.find("controller"), 3);
+}
+
+
+TEST(Vic2World_Save_SaveKeysTests, UnknownKeysAreNotFound)
+{
+	const Vic2::KeywordTable<int> keywords{{"owner", 1}, {"core", 2}};
+
+	EXPECT_EQ(keywords.find(""), std::nullopt);
+	EXPECT_EQ(keywords.find("cor"), std::nullopt);
+	EXPECT_EQ(keywords.find("cores"), std::nullopt);
+}
+
+
+TEST(Vic2World_Save_SaveKeysTests, SimilarKeywordsAreToldApart)
+{
+	const Vic2::KeywordTable<int> keywords{{"aristocrats", 0},
+		 {"artisans", 1},
+		 {"bureaucrats", 2},
+		 {"capitalists", 3},
+		 {"clergymen", 4},
+		 {"craftsmen", 5},
+		 {"clerks", 6},
+		 {"farmers", 7},
+		 {"soldiers", 8},
+		 {"officers", 9},
+		 {"labourers", 10},
+		 {"slaves", 11},
+		 {"serfs", 12}};
+
+	EXPECT_EQ(keywords.find("aristocrats"), 0);
+	EXPECT_EQ(keywords.find("artisans"), 1);
+	EXPECT_EQ(keywords.find("bureaucrats"), 2);
+	EXPECT_EQ(keywords.find("capitalists"), 3);
+	EXPECT_EQ(keywords.find("clergymen"), 4);
+	EXPECT_EQ(keywords.find("craftsmen"), 5);
+	EXPECT_EQ(keywords.find("clerks"), 6);
+	EXPECT_EQ(keywords.find("farmers"), 7);
+	EXPECT_EQ(keywords.find("soldiers"), 8);
+	EXPECT_EQ(keywords.find("officers"), 9);
+	EXPECT_EQ(keywords.find("labourers"), 10);
+	EXPECT_EQ(keywords.find("slaves"), 11);
+	EXPECT_EQ(keywords.find("serfs"), 12);
+	EXPECT_EQ(keywords.find("serf"), std::nullopt);
+}
+
+
+TEST(Vic2World_Save_SaveKeysTests, RepeatedKeywordsThrowException)
+{
+	EXPECT_THROW(const Vic2::KeywordTable<int> keywords({{"owner", 1}, {"core", 2}, {"owner", 3}}), std::runtime_error);
+}
@@ -0,0 +1,201 @@
+#include "V2World/Save/SaveTokenizer.h"
+#include "gmock/gmock-matchers.h"
+#include "gtest/gtest.h"
+
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, TokensAreSplitOnWhitespaceBracesAndEquals)
+{
+	Vic2::SaveTokenizer tokenizer("key={value}\n\tother = \"quoted value\"");
+
+	EXPECT_EQ(tokenizer.getNextToken(), "key");
+	EXPECT_EQ(tokenizer.getNextToken(), "=");
+	EXPECT_EQ(tokenizer.getNextToken(), "{");
+	EXPECT_EQ(tokenizer.getNextToken(), "value");
+	EXPECT_EQ(tokenizer.getNextToken(), "}");
+	EXPECT_EQ(tokenizer.getNextToken(), "other");
+	EXPECT_EQ(tokenizer.getNextToken(), "=");
+	EXPECT_EQ(tokenizer.getNextToken(), "\"quoted value\"");
+	EXPECT_EQ(tokenizer.getNextToken(), std::nullopt);
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, CommentsAreSkipped)
+{
+	Vic2::SaveTokenizer tokenizer("# a comment = {\nkey # another comment\n");
+
+	EXPECT_EQ(tokenizer.getNextToken(), "key");
+	EXPECT_EQ(tokenizer.getNextToken(), std::nullopt);
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, PeekingDoesNotConsumeTokens)
+{
+	Vic2::SaveTokenizer tokenizer("key");
+
+	EXPECT_EQ(tokenizer.peekToken(), "key");
+	EXPECT_EQ(tokenizer.getNextToken(), "key");
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, ValuesCanBeRead)
+{
+	Vic2::SaveTokenizer tokenizer("= \"string\" = 42 = 0.5");
+
+	EXPECT_EQ(tokenizer.getString(), "string");
+	EXPECT_EQ(tokenizer.getInt(), 42);
+	EXPECT_DOUBLE_EQ(tokenizer.getDouble(), 0.5);
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, MalformedNumbersAreZero)
+{
+	Vic2::SaveTokenizer tokenizer("= not_a_number = not_a_number = 12abc");
+
+	EXPECT_EQ(tokenizer.getInt(), 0);
+	EXPECT_DOUBLE_EQ(tokenizer.getDouble(), 0.0);
+	EXPECT_EQ(tokenizer.getInt(), 0);
+	EXPECT_THAT(tokenizer.getWarnings(),
+		 testing::ElementsAre("Could not read a number from not_a_number",
+			  "Could not read a number from not_a_number",
+			  "Could not read a number from 12abc"));
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, DecimalsAreDroppedFromInts)
+{
+	Vic2::SaveTokenizer tokenizer("= 42.000 = { 1.5 2 }");
+
+	EXPECT_EQ(tokenizer.getInt(), 42);
+	EXPECT_THAT(tokenizer.getInts(), testing::ElementsAre(1, 2));
+	EXPECT_TRUE(tokenizer.getWarnings().empty());
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, ListsCanBeRead)
+{
+	Vic2::SaveTokenizer tokenizer("= { 1 2 3 } = { 1.5 2.000 } = { \"one\" two }");
+
+	EXPECT_THAT(tokenizer.getInts(), testing::ElementsAre(1, 2, 3));
+	EXPECT_THAT(tokenizer.getDoubles(), testing::ElementsAre(1.5, 2.0));
+	EXPECT_THAT(tokenizer.getStrings(), testing::ElementsAre("one", "two"));
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, SingleValueIsReadAsList)
+{
+	Vic2::SaveTokenizer tokenizer("= 1.000");
+
+	EXPECT_THAT(tokenizer.getDoubles(), testing::ElementsAre(1.0));
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, BlockItemsAreVisitedInOrder)
+{
+	Vic2::SaveTokenizer tokenizer("= { first = 1 second = { nested = yes } third = 3 } after");
+
+	std::vector<std::pair<std::string, int>> items;
+	tokenizer.parseBlock([&tokenizer, &items](const std::string_view key) {
+		if (key == "second")
+		{
+			tokenizer.skipItem();
+			items.emplace_back(key, 0);
+		}
+		else
+		{
+			items.emplace_back(key, tokenizer.getInt());
+		}
+	});
+
+	EXPECT_THAT(items,
+		 testing::ElementsAre(std::make_pair("first", 1), std::make_pair("second", 0), std::make_pair("third", 3)));
+	EXPECT_EQ(tokenizer.getNextToken(), "after");
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, UnbracedBlockRunsToEndOfEnclosingBlock)
+{
+	Vic2::SaveTokenizer tokenizer("{ first = 1 second = 2 } after");
+	ASSERT_EQ(tokenizer.getNextToken(), "{");
+
+	std::vector<std::string> keys;
+	tokenizer.parseBlock([&tokenizer, &keys](const std::string_view key) {
+		keys.emplace_back(key);
+		tokenizer.skipItem();
+	});
+
+	EXPECT_THAT(keys, testing::ElementsAre("first", "second"));
+	EXPECT_EQ(tokenizer.getNextToken(), "}");
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, AssignmentsCanBeRead)
+{
+	Vic2::SaveTokenizer tokenizer("= { one = 1 two = \"2\" block = { 3 } }");
+
+	std::vector<std::pair<std::string, std::string>> assignments;
+	tokenizer.parseAssignments([&assignments](const std::string_view key, const std::string_view value) {
+		assignments.emplace_back(key, value);
+	});
+
+	EXPECT_THAT(assignments, testing::ElementsAre(std::make_pair("one", "1"), std::make_pair("two", "\"2\"")));
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, ItemsCanBeSkipped)
+{
+	Vic2::SaveTokenizer tokenizer("= value next = { a = { b } } last");
+
+	tokenizer.skipItem();
+	EXPECT_EQ(tokenizer.getNextToken(), "next");
+	tokenizer.skipItem();
+	EXPECT_EQ(tokenizer.getNextToken(), "last");
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, SkippingIgnoresBracesInQuotesAndComments)
+{
+	Vic2::SaveTokenizer tokenizer(
+		 "= { name = \"}{ \\\" }\" # a comment }\n inner = { \"{\" } } next = { \"unterminated } last");
+
+	tokenizer.skipItem();
+	EXPECT_EQ(tokenizer.getNextToken(), "next");
+	tokenizer.skipItem();
+	EXPECT_EQ(tokenizer.getNextToken(), std::nullopt);
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, SkippingUnclosedBlockStopsAtEnd)
+{
+	Vic2::SaveTokenizer tokenizer("= { a = { b }");
+
+	tokenizer.skipItem();
+	EXPECT_EQ(tokenizer.getNextToken(), std::nullopt);
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, SkippingItemWithoutValueConsumesNothing)
+{
+	Vic2::SaveTokenizer tokenizer("next");
+
+	tokenizer.skipItem();
+	EXPECT_EQ(tokenizer.getNextToken(), "next");
+}
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, ItemTextIncludesBraces)
+{
+	Vic2::SaveTokenizer tokenizer("= { a = { b } } = value");
+
+	EXPECT_EQ(tokenizer.getItem(), "{ a = { b } }");
+	EXPECT_EQ(tokenizer.getItem(), "value");
+}
+
+
+
+TEST(Vic2World_Save_SaveTokenizerTests, QuotesCanBeRemoved)
+{
+	EXPECT_EQ(Vic2::removeQuotes("\"quoted\""), "quoted");
+	EXPECT_EQ(Vic2::removeQuotes("unquoted"), "unquoted");
+	EXPECT_EQ(Vic2::removeQuotes("\""), "\"");
+}
@@ -117,4 +117,21 @@ TEST(Vic2World_States_StateDefinitionsFactoryTests, VanillaStateCapitalsAreImpor
 	const auto stateDefinitions = Vic2::StateDefinitions::Factory().getStateDefinitions(*configuration);
 
 	ASSERT_EQ(1, stateDefinitions->getCapitalProvince("VANILLA_STATE"));
-}
\ No newline at end of file
+}
+
+
+TEST(Vic2World_States_StateDefinitionsFactoryTests, SharedStateDefinitionsAreLoadedOncePerInstallAndMods)
+{
+	const auto configuration = Configuration::Builder().setVic2Path("./").build();
+	const auto modConfiguration =
+		 Configuration::Builder().setVic2Path("./").addVic2Mod(Mod("test mod", "mod/test_mod/")).build();
+
+	const auto stateDefinitions = Vic2::StateDefinitions::Factory::loadStateDefinitions(*configuration);
+	const auto modStateDefinitions = Vic2::StateDefinitions::Factory::loadStateDefinitions(*modConfiguration);
+
+	EXPECT_EQ(stateDefinitions, Vic2::StateDefinitions::Factory::loadStateDefinitions(*configuration));
+	EXPECT_NE(stateDefinitions, modStateDefinitions);
+	EXPECT_EQ(modStateDefinitions, Vic2::StateDefinitions::Factory::loadStateDefinitions(*modConfiguration));
+	EXPECT_EQ("VANILLA_STATE", stateDefinitions->getStateID(1));
+	EXPECT_EQ("MOD_STATE", modStateDefinitions->getStateID(4));
+}
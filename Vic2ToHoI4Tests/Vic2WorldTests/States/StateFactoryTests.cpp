@@ -17,7 +17,9 @@ using Vic2::PopOptions;
 TEST(Vic2World_States_StateFactoryTests, GetStateSetsOwner)
 {
 	std::stringstream input;
-	const auto state = Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build());
+	std::vector<std::string> warnings;
+	const auto state =
+		 Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build(), warnings);
 
 	ASSERT_EQ("TAG", state->getOwner());
 }
@@ -34,7 +36,9 @@ TEST(Vic2World_States_StateFactoryTests, GetUnownedStateSetsEmptyOwner)
 TEST(Vic2World_States_StateFactoryTests, ProvinceNumbersDefaultsEmpty)
 {
 	std::stringstream input;
-	const auto state = Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build());
+	std::vector<std::string> warnings;
+	const auto state =
+		 Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build(), warnings);
 
 	ASSERT_TRUE(state->getProvinceNumbers().empty());
 }
@@ -43,7 +47,9 @@ TEST(Vic2World_States_StateFactoryTests, ProvinceNumbersDefaultsEmpty)
 TEST(Vic2World_States_StateFactoryTests, ProvinceNumbersDefaultsEmptyInUnowned)
 {
 	std::stringstream input;
-	const auto state = Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build());
+	std::vector<std::string> warnings;
+	const auto state =
+		 Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build(), warnings);
 
 	ASSERT_TRUE(state->getProvinceNumbers().empty());
 }
@@ -55,7 +61,9 @@ TEST(Vic2World_States_StateFactoryTests, GetStateSetsProvinceNumbers)
 	input << "= {\n";
 	input << "\tprovinces = { 42 }\n";
 	input << "}\n";
-	const auto state = Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build());
+	std::vector<std::string> warnings;
+	const auto state =
+		 Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build(), warnings);
 
 	ASSERT_EQ(std::set{42}, state->getProvinceNumbers());
 }
@@ -83,7 +91,9 @@ TEST(Vic2World_States_StateFactoryTests, GetUnownedStateSetsProvinces)
 TEST(Vic2World_States_StateFactoryTests, StateIdDefaultsToEmpty)
 {
 	std::stringstream input;
-	const auto state = Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build());
+	std::vector<std::string> warnings;
+	const auto state =
+		 Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build(), warnings);
 
 	ASSERT_TRUE(state->getStateID().empty());
 }
@@ -102,9 +112,11 @@ TEST(Vic2World_States_StateFactoryTests, GetStateSetsStateId)
 	input << "= {\n";
 	input << "\tprovinces = { 42 }\n";
 	input << "}\n";
+	std::vector<std::string> warnings;
 	const auto state = Vic2::State::Factory().getState(input,
 		 "TAG",
-		 *Vic2::StateDefinitions::Builder().setProvinceToIDMap({{42, "TEST_STATE"}}).build());
+		 *Vic2::StateDefinitions::Builder().setProvinceToIDMap({{42, "TEST_STATE"}}).build(),
+		 warnings);
 
 	ASSERT_EQ("TEST_STATE", state->getStateID());
 }
@@ -122,7 +134,9 @@ TEST(Vic2World_States_StateFactoryTests, GetUnownedStateSetsStateId)
 TEST(Vic2World_States_StateFactoryTests, EmptyStateIsNotPartial)
 {
 	std::stringstream input;
-	const auto state = Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build());
+	std::vector<std::string> warnings;
+	const auto state =
+		 Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build(), warnings);
 
 	ASSERT_FALSE(state->isPartialState());
 }
@@ -142,7 +156,9 @@ TEST(Vic2World_States_StateFactoryTests, StateWithAllProvincesIsNotPartial)
 	input << "= {\n";
 	input << "\tprovinces = { 42 43 }\n";
 	input << "}\n";
-	const auto state = Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build());
+	std::vector<std::string> warnings;
+	const auto state =
+		 Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build(), warnings);
 
 	ASSERT_FALSE(state->isPartialState());
 }
@@ -163,9 +179,11 @@ TEST(Vic2World_States_StateFactoryTests, StateWithMissingProvincesIsPartial)
 	input << "= {\n";
 	input << "\tprovinces = { 42 43 }\n";
 	input << "}\n";
+	std::vector<std::string> warnings;
 	const auto state = Vic2::State::Factory().getState(input,
 		 "TAG",
-		 *Vic2::StateDefinitions::Builder().setStateMap({{42, {43, 44}}, {43, {42, 44}}, {44, {42, 43}}}).build());
+		 *Vic2::StateDefinitions::Builder().setStateMap({{42, {43, 44}}, {43, {42, 44}}, {44, {42, 43}}}).build(),
+		 warnings);
 
 	ASSERT_TRUE(state->isPartialState());
 }
@@ -183,7 +201,9 @@ TEST(Vic2World_States_StateFactoryTests, UnownedStateWithMissingProvincesIsParti
 TEST(Vic2World_States_StateFactoryTests, CapitalProvinceDefaultsToNullopt)
 {
 	std::stringstream input;
-	const auto state = Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build());
+	std::vector<std::string> warnings;
+	const auto state =
+		 Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build(), warnings);
 
 	ASSERT_EQ(std::nullopt, state->getCapitalProvince());
 }
@@ -203,12 +223,14 @@ TEST(Vic2World_States_StateFactoryTests, GetStateSetsCapitalProvince)
 	input << "= {\n";
 	input << "\tprovinces = { 42 }\n";
 	input << "}\n";
+	std::vector<std::string> warnings;
 	const auto state = Vic2::State::Factory().getState(input,
 		 "TAG",
 		 *Vic2::StateDefinitions::Builder()
 				.setProvinceToIDMap({{42, "TEST_STATE"}})
 				.setStateToCapitalMap({{"TEST_STATE", 42}})
-				.build());
+				.build(),
+				warnings);
 
 	ASSERT_EQ(42, state->getCapitalProvince());
 }
@@ -235,7 +257,8 @@ TEST(Vic2World_States_StateFactoryTests, BuildingLevelIsImported)
 	input << "\t\tlevel = 2\n";
 	input << "\t}\n";
 	input << "}\n";
-	auto state = Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build());
+	std::vector<std::string> warnings;
+	auto state = Vic2::State::Factory().getState(input, "TAG", *Vic2::StateDefinitions::Builder().build(), warnings);
 	state->addProvince(
 		 Vic2::Province::Builder().setNumber(42).setPops({Pop(PopOptions{.type = "craftsmen", .size = 50'000})}).build());
 	state->determineEmployedWorkers();